@@ -13,26 +13,60 @@
 #include "Button.h"
 #include "Led.h"
 #include "Dio.h"
+#include "Gpt.h"
 #include "Mcu.h"
 #include "Port.h"
+#include "Os.h"
 
 /* Description: Task executes once to initialize all the Modules */
 void Init_Task(void)
 {
-    /* Initialize Mcu Driver */
-    Mcu_Init();
+    uint32 retries = 0;
+
+    /* Initialize Mcu Driver and move the system clock to the PLL before the drivers compute their dividers */
+    Mcu_Init(&Mcu_Configuration);
+    if(E_OK == Mcu_InitClock(McuConf_PLL_80MHZ_CLOCK_ID))
+    {
+        while((MCU_PLL_LOCKED != Mcu_GetPllStatus()) && (retries < MCU_PLL_LOCK_RETRIES))
+        {
+            retries++;
+        }
+    }
+    if(MCU_PLL_LOCKED == Mcu_GetPllStatus())
+    {
+        Mcu_DistributePllClock();
+    }
+    else
+    {
+        /* No crystal or no PLL lock: stay on the PIOSC, the Os tick and the Gpt driver follow
+         * Mcu_GetClockFrequency */
+        (void)Mcu_InitClock(McuConf_PIOSC_16MHZ_CLOCK_ID);
+    }
 
     /* Initialize Dio Driver */
     Dio_Init(&Dio_Configuration);
 
     /* Initialize Port Driver */
     Port_Init(&Port_Configuration);
+
+    /* Initialize Gpt Driver */
+    Gpt_Init(&Gpt_Configuration);
 }
 
-/* Description: Task executes every 20 Mili-seconds to check the button state */
+/* Description: Task executes every 20 Mili-seconds to check the button state,
+ *              it sends every button state change to App Task through the Os queue */
 void Button_Task(void)
 {
+    static uint8 button_state = BUTTON_RELEASED;
+
     Button_RefreshState();
+
+    if(Button_GetState() != button_state)
+    {
+        button_state = Button_GetState();
+        /* The queue activates App Task, a change is only dropped if App Task is 4 changes late */
+        (void)Os_QueueSend(OsConf_BUTTON_QUEUE_ID_INDEX, &button_state);
+    }
 }
 
 /* Description: Task executes every 40 Mili-seconds to refresh the LED */
@@ -41,20 +75,71 @@ void Led_Task(void)
     Led_RefreshOutput();
 }
 
-/* Description: Task executes every 60 Mili-seconds to get the button status and toggle the led */
+/* Description: Take the button state changes sent by Button Task until the given state is received,
+ *              returns FALSE when the queue is empty before it */
+static boolean App_ReceiveButtonState(uint8 State)
+{
+    uint8 button_state;
+
+    while(Os_QueueReceive(OsConf_BUTTON_QUEUE_ID_INDEX, &button_state) == E_OK)
+    {
+        if(button_state == State)
+        {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+/* Description: Task activated by Button Task on every button state change to toggle the led on a press,
+ *              written as a coroutine which continues at the wait where its last activation stopped */
 void App_Task(void)
 {
-    static uint8 button_previous_state = BUTTON_RELEASED;
-    static uint8 button_current_state  = BUTTON_RELEASED;
+    static Os_CoroutineType app_coroutine = OS_COROUTINE_INIT(OsConf_APP_TASK_ID_INDEX, OS_COROUTINE_NO_TIMER);
 
-    button_current_state = Button_GetState(); /* Read the button state */
+    OS_COROUTINE_BEGIN(&app_coroutine);
 
-    /* Only Toggle the led in case the current state of the switch is pressed
-     * and the previous state is released */ 
-    if((button_current_state == BUTTON_PRESSED) && (button_previous_state == BUTTON_RELEASED))
+    while(1)
     {
+        /* Only Toggle the led when the switch is pressed after being released */
+        OS_COROUTINE_WAIT_UNTIL(&app_coroutine, App_ReceiveButtonState(BUTTON_PRESSED));
+
+        /* Led Task must not refresh the output in the middle of the toggle */
+        OS_ENTER_EXCLUSIVE_AREA(OsConf_LED_RESOURCE_ID_INDEX);
         Led_Toggle();
+        OS_EXIT_EXCLUSIVE_AREA(OsConf_LED_RESOURCE_ID_INDEX);
+
+        OS_COROUTINE_WAIT_UNTIL(&app_coroutine, App_ReceiveButtonState(BUTTON_RELEASED));
+    }
+
+    OS_COROUTINE_END(&app_coroutine);
+}
+
+#if (OS_STACK_MONITORING == STD_ON)
+/* Description: Os hook called from the tick interrupt when the guard words of a stack were overwritten */
+void Os_StackOverflowHook(Os_StackType StackId)
+{
+    /* The memory under the stack may be corrupted, stop here so the overflow is not missed
+     * while debugging (the stack sizes are checked with Os_GetStackUsage) */
+    (void)StackId;
+    while(1)
+    {
     }
+}
+#endif
 
-    button_previous_state = button_current_state;
+#if (OS_OVERRUN_HOOK == STD_ON)
+/* Description: Os hook called for every deadline overrun or lost activation of a task,
+ *              the counters are kept by the Os and read with Os_GetTaskOverruns */
+void Os_OverrunHook(Os_TaskType TaskId, uint8 Reason)
+{
+    /* No recovery is needed by the application tasks, they only refresh/sample states
+     * Add a breakpoint here to catch the overruns while debugging */
+#if (OS_TRACE == STD_ON)
+    /* Keep the events which led to the first overrun for the trace dump */
+    Os_TraceStop();
+#endif
+    (void)TaskId;
+    (void)Reason;
 }
+#endif
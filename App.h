@@ -17,13 +17,15 @@
 /* Description: Task executes once to initialize all the Modules */
 void Init_Task(void);
 
-/* Description: Task executes every 20 Mili-seconds to check the button state */
+/* Description: Task executes every 20 Mili-seconds to check the button state,
+ *              it sends every button state change to App Task through the Os queue */
 void Button_Task(void);
 
 /* Description: Task executes every 40 Mili-seconds to refresh the LED */
 void Led_Task(void);
 
-/* Description: Task executes every 60 Mili-seconds to get the button status and toggle the led */
+/* Description: Task activated by Button Task on every button state change to toggle the led on a press,
+ *              written as a coroutine which continues at the wait where its last activation stopped */
 void App_Task(void);
 
 #endif /* APP_H_ */
@@ -9,12 +9,19 @@
  * Author: Yahia Hamimi
  ******************************************************************************/
 #include "Dio.h"
+#include "Os.h"
 
 #include "Button.h"
 
 /* Global variable to hold the button state */
 static uint8 g_button_state = BUTTON_RELEASED;
 
+/* Global variable to hold the last level read from the button */
+static uint8 g_button_level = BUTTON_RELEASED;
+
+/* Global variable to hold the Os time of the last change of the button level */
+static Os_TimeType g_button_level_time = 0;
+
 
 /*******************************************************************************************************************/
 uint8 Button_GetState(void)
@@ -26,35 +33,22 @@ uint8 Button_GetState(void)
 void Button_RefreshState(void)
 {
     uint8 state = Dio_ReadChannel(DioConf_SW1_CHANNEL_ID_INDEX);
+    Os_TimeType time = Os_GetTime();
 
-    /* Count the number of Pressed times increment if the switch pressed for 20 ms */
-    static uint8 g_Pressed_Count  = 0;
-
-    /* Count the number of Released times increment if the switch released for 20 ms */
-    static uint8 g_Released_Count = 0;
-
-    if(state == BUTTON_PRESSED)
+    if(state != g_button_level)
     {
-        g_Pressed_Count++;
-        g_Released_Count = 0;
+        /* The level changed, restart the debounce time */
+        g_button_level      = state;
+        g_button_level_time = time;
     }
-    else
+    else if((time - g_button_level_time) >= BUTTON_DEBOUNCE_TIME)
     {
-        g_Released_Count++;
-        g_Pressed_Count = 0;
+        /* The level is stable for the debounce time */
+        g_button_state = state;
     }
-
-    if(g_Pressed_Count == 3)
-    {
-        g_button_state = BUTTON_PRESSED;
-        g_Pressed_Count       = 0;
-        g_Released_Count      = 0;
-    }
-    else if(g_Released_Count == 3)
+    else
     {
-        g_button_state = BUTTON_RELEASED;
-        g_Released_Count      = 0;
-        g_Pressed_Count       = 0;
+        /* Still bouncing, keep the previous state */
     }
 }
 /*******************************************************************************************************************/
@@ -21,8 +21,9 @@ uint8 Button_GetState(void);
 
 /* 
  * Description: This function is called every 20ms by Os Task and it responsible for Updating 
- *              the BUTTON State. it should be in a PRESSED State if the button is pressed for 60ms.
- *		        and it should be in a RELEASED State if the button is released for 60ms.
+ *              the BUTTON State. it should be in a PRESSED State if the button is pressed for
+ *              BUTTON_DEBOUNCE_TIME and it should be in a RELEASED State if the button is released
+ *              for BUTTON_DEBOUNCE_TIME (measured with the Os time).
  */   
 void Button_RefreshState(void);
 
@@ -22,5 +22,8 @@
 /* Set the Button Pin Number */
 #define BUTTON_PIN_NUM DioConf_SW1_CHANNEL_NUM
 
+/* Time in ms the button level must stay stable before the new state is accepted */
+#define BUTTON_DEBOUNCE_TIME (40U)
+
 
 #endif /* BUTTON_CFG_H_ */
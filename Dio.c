@@ -11,6 +11,7 @@
 
 #include "Dio.h"
 #include "Dio_Regs.h"
+#include "Mcu.h"
 
 #if (DIO_DEV_ERROR_DETECT == STD_ON)
 
@@ -36,10 +37,14 @@ STATIC uint8 Dio_Status = DIO_NOT_INITIALIZED;
 * Parameters (inout): None
 * Parameters (out): None
 * Return value: None
-* Description: Function to Initialize the Dio module.
+* Description: Function to Initialize the Dio module and enable the clock of the ports
+*              of the configured channels (the other ports stay unclocked).
 ************************************************************************************/
 void Dio_Init(const Dio_ConfigType * ConfigPtr)
 {
+	uint8 channel;
+	uint8 ports_mask = 0;
+
 #if (DIO_DEV_ERROR_DETECT == STD_ON)
 	/* check if the input configuration pointer is not a NULL_PTR */
 	if (NULL_PTR == ConfigPtr)
@@ -56,6 +61,13 @@ void Dio_Init(const Dio_ConfigType * ConfigPtr)
 		 */
 		Dio_Status       = DIO_INITIALIZED;
 		Dio_PortChannels = ConfigPtr->Channels; /* address of the first Channels structure --> Channels[0] */
+
+		/* Enable the clock of the used ports and wait until all of them are ready */
+		for(channel = 0; channel < DIO_CONFIGURED_CHANNLES; channel++)
+		{
+			ports_mask |= (uint8)(1U << Dio_PortChannels[channel].Port_Num);
+		}
+		Mcu_EnableGpioClocks(ports_mask);
 	}
 }
 
@@ -69,7 +81,8 @@ void Dio_Init(const Dio_ConfigType * ConfigPtr)
 * Parameters (inout): None
 * Parameters (out): None
 * Return value: None
-* Description: Function to set a level of a channel.
+* Description: Function to set a level of a channel with a single store to the masked address
+*              of the channel, the other pins of the port are not read nor written.
 ************************************************************************************/
 void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
 {
@@ -121,15 +134,17 @@ void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
             case 5:    Port_Ptr = &GPIO_PORTF_DATA_REG;
 		               break;
 		}
+		/* Only the channel pin is selected by the address */
+		Port_Ptr = GPIO_DATA_PIN_ADDRESS(Port_Ptr, Dio_PortChannels[ChannelId].Ch_Num);
 		if(Level == STD_HIGH)
 		{
 			/* Write Logic High */
-			SET_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
+			*Port_Ptr = GPIO_DATA_ALL_PINS;
 		}
 		else if(Level == STD_LOW)
 		{
 			/* Write Logic Low */
-			CLEAR_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
+			*Port_Ptr = 0;
 		}
 	}
 	else
@@ -266,7 +281,9 @@ void Dio_GetVersionInfo(Std_VersionInfoType *versioninfo)
 * Parameters (inout): None
 * Parameters (out): None
 * Return value: Dio_LevelType
-* Description: Function to flip the level of a channel and return the level of the channel after flip.
+* Description: Function to flip the level of a channel and return the level of the channel after flip,
+*              the channel is read and written through its masked address (the other pins of
+*              the port are not written).
 ************************************************************************************/
 #if (DIO_FLIP_CHANNEL_API == STD_ON)
 Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId)
@@ -320,15 +337,18 @@ Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId)
             case 5:    Port_Ptr = &GPIO_PORTF_DATA_REG;
 		               break;
 		}
+		/* Only the channel pin is selected by the address */
+		Port_Ptr = GPIO_DATA_PIN_ADDRESS(Port_Ptr, Dio_PortChannels[ChannelId].Ch_Num);
+
 		/* Read the required channel and write the required level */
-		if(GET_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num) == STD_HIGH)
+		if(*Port_Ptr != 0)
 		{
-			CLEAR_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
+			*Port_Ptr = 0;
 			output = STD_LOW;
 		}
 		else
 		{
-			SET_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
+			*Port_Ptr = GPIO_DATA_ALL_PINS;
 			output = STD_HIGH;
 		}
 	}
@@ -21,4 +21,14 @@
 #define GPIO_PORTE_DATA_REG       (*((volatile uint32 *)0x400243FC))
 #define GPIO_PORTF_DATA_REG       (*((volatile uint32 *)0x400253FC))
 
+/* The DATA register is mirrored on 256 addresses: the address bits [9:2] mask the pins accessed,
+ * the registers above use the address of all the pins (offset 0x3FC) */
+#define GPIO_DATA_ALL_PINS_OFFSET 0x3FC
+#define GPIO_DATA_ALL_PINS        0xFF
+
+/* Address of the DATA register seen through a single pin: a store changes this pin only
+ * and a load reads the other pins as 0 */
+#define GPIO_DATA_PIN_ADDRESS(DATA_REG_PTR, PIN) \
+    ((volatile uint32 *)((volatile uint8 *)(DATA_REG_PTR) - GPIO_DATA_ALL_PINS_OFFSET + (1U << ((PIN) + 2U))))
+
 #endif /* DIO_REGS_H */
@@ -4,30 +4,184 @@
  *
  * File Name: Gpt.c
  *
- * Description: Source file for TM4C123GH6PM Microcontroller - SysTick Timer Driver.
+ * Description: Source file for TM4C123GH6PM Microcontroller - Gpt Driver
+ *              (GPTM 16/32-bit and 32/64-bit wide timers, SysTick Timer of the Os).
  *
  * Author: Yahia Hamimi
  ******************************************************************************/
 
 #include "Gpt.h"
+#include "Gpt_Regs.h"
 #include "tm4c123gh6pm_registers.h"
 
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+
+#include "Det.h"
+/* AUTOSAR Version checking between Det and Gpt Modules */
+#if ((DET_AR_MAJOR_VERSION != GPT_AR_RELEASE_MAJOR_VERSION)\
+ || (DET_AR_MINOR_VERSION != GPT_AR_RELEASE_MINOR_VERSION)\
+ || (DET_AR_PATCH_VERSION != GPT_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Det.h does not match the expected version"
+#endif
+
+#endif
+
 #define SYSTICK_PRIORITY_MASK  0x1FFFFFFF
 #define SYSTICK_INTERRUPT_PRIORITY  3
 #define SYSTICK_PRIORITY_BITS_POS   29
 
+/* Range of the 24-bit reload value of the SysTick Timer */
+#define SYSTICK_RELOAD_RANGE        0x01000000UL
+
+/* PENDSTSET bit in the Interrupt Control and State register ... SysTick interrupt is pending */
+#define SYSTICK_PENDING_MASK        0x04000000
+
+/* Minimum remaining count to safely change the reload value before the counter wraps */
+#define SYSTICK_RELOAD_GUARD        256
+
 /* Global pointer to function used to point upper layer functions
  * to be used in Call Back */
 static void (*g_SysTick_Call_Back_Ptr)(void) = NULL_PTR;
 
+/* System clocks counted by the SysTick Timer in 1 milisecond, taken from Mcu_GetClockFrequency
+ * by SysTick_Start so the Os tick keeps its length on the fallback clock */
+static uint32 g_SysTick_Clocks_Per_Ms = 0;
+
+/* Longest chunk in miliseconds counted with the 24-bit reload value, longer periods are
+ * cut into chunks by the software prescaler of the SysTick_Handler */
+static uint16 g_SysTick_Max_Chunk_Ms = 0;
+
+/* Length in miliseconds of the SysTick periods following the one being cut into chunks */
+static volatile uint16 g_SysTick_Period_Ms = 0;
+
+/* Miliseconds of the period being cut into chunks not yet given to the reload register */
+static volatile uint16 g_SysTick_Left_Ms = 0;
+
+/* TRUE when the chunk counting / the chunk held by the reload register ends a period */
+static volatile boolean g_SysTick_Running_Ends = TRUE;
+static volatile boolean g_SysTick_Reload_Ends = TRUE;
+
+/* States of a Gpt channel */
+#define GPT_CHANNEL_INITIALIZED     (0U)
+#define GPT_CHANNEL_RUNNING         (1U)
+#define GPT_CHANNEL_STOPPED         (2U)
+#define GPT_CHANNEL_EXPIRED         (3U)
+
+/* The GPTM block drives no channel */
+#define GPT_NO_CHANNEL              (Gpt_ChannelType)0xFF
+
+#if (GPT_TIMESTAMP_API == STD_ON)
+/* Wide GPTM block counting the timestamp */
+#define GPT_TIMESTAMP_HW_TIMER      (Gpt_HwTimerType)(GPT_WIDE_TIMER_0 + GPT_TIMESTAMP_WIDE_TIMER)
+#endif
+
+/* Range of the 16-bit prescaler of the wide GPTM blocks */
+#define GPT_PRESCALER_RANGE         (0x10000UL)
+
+#if (GPT_DELAY_API == STD_ON)
+/* VECTACTIVE field of the Interrupt Control and State register ... non zero in an interrupt handler */
+#define GPT_VECTACTIVE_MASK         0x000001FF
+
+/* Priority of the timestamp match interrupt waking Gpt_DelayUs: BASEPRI never masks priority 0
+ * so the Os resource ceilings held by the caller cannot keep the CPU asleep */
+#define GPT_WAKEUP_PRIORITY         (0U)
+
+/* Enable/Disable IRQ Interrupts by clearing/setting the I-bit in the PRIMASK */
+#define Gpt_Enable_Interrupts()     __asm(" CPSIE I ")
+#define Gpt_Disable_Interrupts()    __asm(" CPSID I ")
+
+/* Wait For Interrupt ... the CPU sleeps until an interrupt is pending (even if masked by PRIMASK) */
+#define Gpt_Wait_For_Interrupt()    __asm(" WFI ")
+
+/* Implemented in Gpt_CortexM4.asm: PRIMASK of the caller, non zero while the interrupts are masked */
+extern uint32 Gpt_PortGetPrimask(void);
+#endif
+
+/* Highest NVIC priority value (3 implemented priority bits) */
+#define GPT_MAX_PRIORITY            (7U)
+
+/* Register of a GPTM block */
+#define GPT_HW_REG(HwTimer, Offset) (*(volatile uint32 *)((volatile uint8 *)Gpt_HwBase[HwTimer] + (Offset)))
+
+STATIC const Gpt_ConfigChannel * Gpt_Channels = NULL_PTR;
+STATIC uint8 Gpt_Status = GPT_NOT_INITIALIZED;
+
+/* Base address of every GPTM block (GPT_TIMER_x then GPT_WIDE_TIMER_x) */
+STATIC const uint32 Gpt_HwBase[GPT_HW_TIMERS] = {
+                                                    GPT_TIMER0_BASE_ADDRESS, GPT_TIMER1_BASE_ADDRESS,
+                                                    GPT_TIMER2_BASE_ADDRESS, GPT_TIMER3_BASE_ADDRESS,
+                                                    GPT_TIMER4_BASE_ADDRESS, GPT_TIMER5_BASE_ADDRESS,
+                                                    GPT_WIDE_TIMER0_BASE_ADDRESS, GPT_WIDE_TIMER1_BASE_ADDRESS,
+                                                    GPT_WIDE_TIMER2_BASE_ADDRESS, GPT_WIDE_TIMER3_BASE_ADDRESS,
+                                                    GPT_WIDE_TIMER4_BASE_ADDRESS, GPT_WIDE_TIMER5_BASE_ADDRESS
+                                                };
+
+/* NVIC interrupt number of the timer A time-out of every GPTM block */
+STATIC const uint8 Gpt_HwIrq[GPT_HW_TIMERS] = { 19, 21, 23, 35, 70, 92, 94, 96, 98, 100, 102, 104 };
+
+/* Channel driven by every GPTM block, used by the interrupt handlers */
+STATIC Gpt_ChannelType Gpt_HwChannel[GPT_HW_TIMERS];
+
+/* State of every channel, the interrupt moves an expired one-shot channel to GPT_CHANNEL_EXPIRED */
+STATIC volatile uint8 Gpt_ChannelState[GPT_CONFIGURED_CHANNELS];
+
+/* Target time given to Gpt_StartTimer and elapsed time when the channel was stopped */
+STATIC Gpt_ValueType Gpt_TargetTime[GPT_CONFIGURED_CHANNELS];
+STATIC Gpt_ValueType Gpt_StopTime[GPT_CONFIGURED_CHANNELS];
+
+/* TRUE while the notification of the channel is enabled */
+STATIC volatile boolean Gpt_NotificationEnabled[GPT_CONFIGURED_CHANNELS];
+
+#if (GPT_TIMESTAMP_API == STD_ON)
+/* System clocks per microsecond counted by the timestamp, set from Mcu_GetClockFrequency by Gpt_Init */
+STATIC uint32 Gpt_TimestampCyclesPerUs = (GPT_SYSTEM_CLOCK_HZ / 1000000UL);
+#endif
+
+#if (GPT_PREDEF_TIMER_API == STD_ON)
+/* Wrap mask of every predefined timer (Gpt_PredefTimerType order) */
+STATIC const uint32 Gpt_PredefTimerMask[] = { 0x0000FFFF, 0x00FFFFFF, 0xFFFFFFFF, 0xFFFFFFFF };
+#endif
+
+/************************************************************************************
+* Service Name: SysTick_NextChunk
+* Description: Reload value of the next chunk of the period being cut, the next period
+*              is started once the last chunk of the previous one was given out
+************************************************************************************/
+static uint32 SysTick_NextChunk(void)
+{
+    uint16 chunk_ms;
+
+    if(0U == g_SysTick_Left_Ms)
+    {
+        g_SysTick_Left_Ms = g_SysTick_Period_Ms;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+
+    chunk_ms = (g_SysTick_Left_Ms > g_SysTick_Max_Chunk_Ms) ? g_SysTick_Max_Chunk_Ms : g_SysTick_Left_Ms;
+    g_SysTick_Left_Ms -= chunk_ms;
+    g_SysTick_Reload_Ends = (0U == g_SysTick_Left_Ms) ? TRUE : FALSE;
+
+    /* The counter wraps from 0 to the reload value: RELOAD + 1 clocks per chunk */
+    return ((uint32)chunk_ms * g_SysTick_Clocks_Per_Ms) - 1UL;
+}
+
 /************************************************************************************
 * Service Name: SysTick_Handler
 * Description: SysTick Timer ISR
 ************************************************************************************/
 void SysTick_Handler(void)
 {
-    /* Check if the SysTick_SetCallBack is already called */
-    if(g_SysTick_Call_Back_Ptr != NULL_PTR)
+    boolean period_end = g_SysTick_Running_Ends;
+
+    /* The hardware took the chunk of the reload register at the wrap, give it the one after */
+    g_SysTick_Running_Ends = g_SysTick_Reload_Ends;
+    SYSTICK_RELOAD_REG = SysTick_NextChunk();
+
+    /* Check if the SysTick_SetCallBack is already called, only the end of a whole period is reported */
+    if((TRUE == period_end) && (g_SysTick_Call_Back_Ptr != NULL_PTR))
     {
         (*g_SysTick_Call_Back_Ptr)(); /* call the function in the scheduler using call-back concept */
     }
@@ -37,26 +191,39 @@ void SysTick_Handler(void)
 /************************************************************************************
 * Service Name: SysTick_Start
 * Sync/Async: Synchronous
-* Reentrancy: reentrant
-* Parameters (in): Tick_Time - Time in miliseconds
+* Reentrancy: Non reentrant
+* Parameters (in): Tick_Time - Time in miliseconds (1 to 65535)
 * Parameters (inout): None
 * Parameters (out): None
 * Return value: None
 * Description: Function to Setup the SysTick Timer configuration to count n miliseconds:
-*              - Set the Reload value
-*              - Enable SysTick Timer with System clock 16Mhz
+*              - Set the Reload value from the system clock of the Mcu Driver, periods
+*                longer than the 24-bit reload range are counted in chunks
+*              - Enable SysTick Timer with the System clock
 *              - Enable SysTick Timer Interrupt and set its priority
 ************************************************************************************/
 void SysTick_Start(uint16 Tick_Time)
 {
     SYSTICK_CTRL_REG    = 0;                         /* Disable the SysTick Timer by Clear the ENABLE Bit */
-    SYSTICK_RELOAD_REG  = 15999 * Tick_Time;         /* Set the Reload value to count n miliseconds */
+    if(0U == Tick_Time)
+    {
+        return;                                      /* A period of 0 ms leaves the SysTick Timer stopped */
+    }
+    /* The system clock may not be a whole number of kHz: a ms rounds down to whole clocks */
+    g_SysTick_Clocks_Per_Ms = Mcu_GetClockFrequency() / 1000UL;
+    g_SysTick_Max_Chunk_Ms  = (uint16)(SYSTICK_RELOAD_RANGE / g_SysTick_Clocks_Per_Ms);
+    g_SysTick_Period_Ms = Tick_Time;
+    g_SysTick_Left_Ms   = 0;
+    SYSTICK_RELOAD_REG  = SysTick_NextChunk();       /* Set the Reload value to count the first chunk */
+    g_SysTick_Running_Ends = g_SysTick_Reload_Ends;
     SYSTICK_CURRENT_REG = 0;                         /* Clear the Current Register value */
     /* Configure the SysTick Control Register 
      * Enable the SysTick Timer (ENABLE = 1)
      * Enable SysTick Interrupt (INTEN = 1)
      * Choose the clock source to be System Clock (CLK_SRC = 1) */
     SYSTICK_CTRL_REG   |= 0x07;
+    /* The counter loaded the first chunk when enabled, the reload register holds the next one */
+    SYSTICK_RELOAD_REG  = SysTick_NextChunk();
     /* Assign priority level 3 to the SysTick Interrupt */
     NVIC_SYSTEM_PRI3_REG =  (NVIC_SYSTEM_PRI3_REG & SYSTICK_PRIORITY_MASK) | (SYSTICK_INTERRUPT_PRIORITY << SYSTICK_PRIORITY_BITS_POS);
 }
@@ -76,6 +243,47 @@ void SysTick_Stop(void)
     SYSTICK_CTRL_REG = 0; /* Disable the SysTick Timer by Clear the ENABLE Bit */
 }
 
+/************************************************************************************
+* Service Name: SysTick_SetNextTime
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Tick_Time - Time in miliseconds (1 to 65535)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_OK: the next period will count Tick_Time
+*                                E_NOT_OK: the counter is about to wrap (or already wrapped)
+*                                          so the next period is left unchanged
+* Description: Function to change the length of the next SysTick period without
+*              disturbing the period in progress (the reload value is only used
+*              by the hardware when the counter wraps). Must be called with the
+*              interrupts disabled.
+************************************************************************************/
+Std_ReturnType SysTick_SetNextTime(uint16 Tick_Time)
+{
+    if(0U == Tick_Time)
+    {
+        return E_NOT_OK;
+    }
+
+    if(TRUE == g_SysTick_Running_Ends)
+    {
+        /* The reload register already holds the first chunk of the next period */
+        if((NVIC_SYSTEM_INTCTRL & SYSTICK_PENDING_MASK) || (SYSTICK_CURRENT_REG < SYSTICK_RELOAD_GUARD))
+        {
+            return E_NOT_OK;
+        }
+        g_SysTick_Period_Ms = Tick_Time;
+        g_SysTick_Left_Ms   = 0;
+        SYSTICK_RELOAD_REG  = SysTick_NextChunk(); /* Loaded by the hardware at the next wrap */
+    }
+    else
+    {
+        /* A long period is still counting its chunks, the next one is cut by the handler */
+        g_SysTick_Period_Ms = Tick_Time;
+    }
+    return E_OK;
+}
+
 /************************************************************************************
 * Service Name: SysTick_SetCallBack
 * Sync/Async: Synchronous
@@ -90,3 +298,880 @@ void SysTick_SetCallBack(void(*Ptr2Func)(void))
 {
     g_SysTick_Call_Back_Ptr = Ptr2Func;
 }
+
+#if (GPT_TIMESTAMP_API == STD_ON)
+/************************************************************************************
+* Service Name: Gpt_StartTimestamp
+* Description: Start the 64-bit up counter of the timestamp block at the system clock, a
+*              timestamp already counting (Gpt_Init after Gpt_DeInit) is left untouched
+************************************************************************************/
+STATIC void Gpt_StartTimestamp(void)
+{
+    Gpt_TimestampCyclesPerUs = Mcu_GetClockFrequency() / 1000000UL;
+
+    /* Kept clocked in the sleep modes so the timestamp counts through the idle sleeps */
+    Mcu_EnableTimerClocks(0U, (uint8)(1U << GPT_TIMESTAMP_WIDE_TIMER));
+
+    if(!(GPT_HW_REG(GPT_TIMESTAMP_HW_TIMER, GPT_CTL_REG_OFFSET) & GPT_CTL_TAEN_MASK))
+    {
+        GPT_HW_REG(GPT_TIMESTAMP_HW_TIMER, GPT_CTL_REG_OFFSET)   = GPT_CTL_TASTALL_MASK;
+        GPT_HW_REG(GPT_TIMESTAMP_HW_TIMER, GPT_CFG_REG_OFFSET)   = GPT_CFG_CONCATENATED;
+        GPT_HW_REG(GPT_TIMESTAMP_HW_TIMER, GPT_TAMR_REG_OFFSET)  = GPT_TAMR_PERIODIC | GPT_TAMR_COUNT_UP | GPT_TAMR_MATCH_INT;
+        GPT_HW_REG(GPT_TIMESTAMP_HW_TIMER, GPT_TAILR_REG_OFFSET) = 0xFFFFFFFF;
+        GPT_HW_REG(GPT_TIMESTAMP_HW_TIMER, GPT_TBILR_REG_OFFSET) = 0xFFFFFFFF;
+        GPT_HW_REG(GPT_TIMESTAMP_HW_TIMER, GPT_IMR_REG_OFFSET)   = 0;
+        GPT_HW_REG(GPT_TIMESTAMP_HW_TIMER, GPT_CTL_REG_OFFSET)  |= GPT_CTL_TAEN_MASK;
+    }
+
+#if (GPT_DELAY_API == STD_ON)
+    /* The match interrupt is only unmasked in the GPTM block while Gpt_DelayUs sleeps */
+    *((volatile uint8 *)GPT_NVIC_PRI_BASE_ADDRESS + Gpt_HwIrq[GPT_TIMESTAMP_HW_TIMER]) = (uint8)(GPT_WAKEUP_PRIORITY << GPT_NVIC_PRIORITY_POS);
+    *((volatile uint32 *)GPT_NVIC_EN_BASE_ADDRESS + (Gpt_HwIrq[GPT_TIMESTAMP_HW_TIMER] / 32U)) = (uint32)1 << (Gpt_HwIrq[GPT_TIMESTAMP_HW_TIMER] % 32U);
+#endif
+}
+
+/************************************************************************************
+* Service Name: Gpt_TimestampStarted
+* Description: TRUE when the timestamp counts, it is stopped before the first Gpt_Init
+************************************************************************************/
+STATIC boolean Gpt_TimestampStarted(void)
+{
+    return ((SYSCTL_PRWTIMER_REG & ((uint32)1 << GPT_TIMESTAMP_WIDE_TIMER))
+            && (GPT_HW_REG(GPT_TIMESTAMP_HW_TIMER, GPT_CTL_REG_OFFSET) & GPT_CTL_TAEN_MASK)) ? TRUE : FALSE;
+}
+
+/************************************************************************************
+* Service Name: Gpt_ReadTimestamp
+* Description: Read the 64-bit timestamp without lock, the two halves are read again
+*              when the lower one wrapped during the read
+************************************************************************************/
+STATIC uint64 Gpt_ReadTimestamp(void)
+{
+    uint32 high;
+    uint32 low;
+
+    do
+    {
+        high = GPT_HW_REG(GPT_TIMESTAMP_HW_TIMER, GPT_TBV_REG_OFFSET);
+        low  = GPT_HW_REG(GPT_TIMESTAMP_HW_TIMER, GPT_TAV_REG_OFFSET);
+    } while(high != GPT_HW_REG(GPT_TIMESTAMP_HW_TIMER, GPT_TBV_REG_OFFSET));
+
+    return ((uint64)high << 32) | low;
+}
+#endif
+
+#if (GPT_PREDEF_TIMER_API == STD_ON)
+/************************************************************************************
+* Service Name: Gpt_PredefTimerValid
+* Description: TRUE when the predefined timer exists and is enabled in Gpt_Cfg.h
+************************************************************************************/
+STATIC boolean Gpt_PredefTimerValid(Gpt_PredefTimerType PredefTimer)
+{
+    if(GPT_PREDEF_TIMER_100US_32BIT == PredefTimer)
+    {
+        return (GPT_PREDEF_TIMER_100US_32BIT_ENABLE == STD_ON) ? TRUE : FALSE;
+    }
+    return ((uint8)PredefTimer < GPT_PREDEF_TIMER_1US_ENABLING_GRADE) ? TRUE : FALSE;
+}
+
+/************************************************************************************
+* Service Name: Gpt_PredefTimerNow
+* Description: Current value of a valid predefined timer read from the timestamp
+************************************************************************************/
+STATIC uint32 Gpt_PredefTimerNow(Gpt_PredefTimerType PredefTimer)
+{
+    uint64 time_us = Gpt_ReadTimestamp() / Gpt_TimestampCyclesPerUs;
+
+    if(GPT_PREDEF_TIMER_100US_32BIT == PredefTimer)
+    {
+        time_us /= 100U;
+    }
+    return (uint32)time_us & Gpt_PredefTimerMask[PredefTimer];
+}
+#endif
+
+#if (GPT_DELAY_API == STD_ON)
+/************************************************************************************
+* Service Name: Gpt_ArmWakeUp
+* Description: Set the timestamp match on the deadline of Gpt_DelayUs and unmask its
+*              interrupt, called with the interrupts disabled
+************************************************************************************/
+STATIC void Gpt_ArmWakeUp(uint64 Deadline)
+{
+    GPT_HW_REG(GPT_TIMESTAMP_HW_TIMER, GPT_TBMATCHR_REG_OFFSET) = (uint32)(Deadline >> 32);
+    GPT_HW_REG(GPT_TIMESTAMP_HW_TIMER, GPT_TAMATCHR_REG_OFFSET) = (uint32)Deadline;
+    GPT_HW_REG(GPT_TIMESTAMP_HW_TIMER, GPT_ICR_REG_OFFSET) = GPT_INT_TAM_MASK;
+    GPT_HW_REG(GPT_TIMESTAMP_HW_TIMER, GPT_IMR_REG_OFFSET) = GPT_INT_TAM_MASK;
+}
+#endif
+
+/************************************************************************************
+* Service Name: Gpt_ScaledPrescaler
+* Description: Prescaler of a channel at the system clock of the Mcu Driver, the configured
+*              one is written for GPT_SYSTEM_CLOCK_HZ so the tick keeps its length on another
+*              clock. GPT_PRESCALER_RANGE when the tick is not a whole number of clocks
+************************************************************************************/
+STATIC uint32 Gpt_ScaledPrescaler(const Gpt_ConfigChannel * Channel)
+{
+    uint64 clocks = ((uint64)Channel->Prescaler + 1U) * Mcu_GetClockFrequency();
+
+    if(((clocks % GPT_SYSTEM_CLOCK_HZ) != 0U) || (clocks < GPT_SYSTEM_CLOCK_HZ))
+    {
+        return GPT_PRESCALER_RANGE;
+    }
+    return (uint32)(clocks / GPT_SYSTEM_CLOCK_HZ) - 1U;
+}
+
+/************************************************************************************
+* Service Name: Gpt_Init
+* Service ID[hex]: 0x01
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): ConfigPtr - Pointer to post-build configuration data
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to Initialize the Gpt module: enable the clock of the GPTM block of
+*              every channel, configure its mode and prescaler and enable its interrupt.
+*              The channels are stopped and their notifications disabled.
+************************************************************************************/
+void Gpt_Init(const Gpt_ConfigType * ConfigPtr)
+{
+    Gpt_ChannelType channel;
+    Gpt_HwTimerType hw_timer;
+    boolean error = FALSE;
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+    uint16 used_timers = 0;
+#if (GPT_TIMESTAMP_API == STD_ON)
+    used_timers = (uint16)1 << GPT_TIMESTAMP_HW_TIMER;
+#endif
+#endif
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+    /* check if the input configuration pointer is not a NULL_PTR */
+    if (NULL_PTR == ConfigPtr)
+    {
+        Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_INIT_SID, GPT_E_PARAM_CONFIG);
+        error = TRUE;
+    }
+    else if (GPT_INITIALIZED == Gpt_Status)
+    {
+        Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_INIT_SID, GPT_E_ALREADY_INITIALIZED);
+        error = TRUE;
+    }
+#if (GPT_TIMESTAMP_API == STD_ON)
+    else if ((Mcu_GetClockFrequency() % 1000000UL) != 0U)
+    {
+        /* The timestamp is converted with a whole number of clocks per microsecond */
+        Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_INIT_SID, GPT_E_PARAM_CONFIG);
+        error = TRUE;
+    }
+#endif
+    else
+    {
+        /* Every channel needs its own GPTM block and only the wide blocks have a prescaler,
+         * the tick of the channel must be a whole number of clocks of the Mcu Driver */
+        for(channel = 0; channel < GPT_CONFIGURED_CHANNELS; channel++)
+        {
+            hw_timer = ConfigPtr->Channels[channel].Hw_Timer;
+            if((hw_timer >= GPT_HW_TIMERS) || (used_timers & ((uint16)1 << hw_timer))
+               || (Gpt_ScaledPrescaler(&ConfigPtr->Channels[channel]) >= ((hw_timer < GPT_WIDE_TIMER_0) ? 1UL : GPT_PRESCALER_RANGE))
+               || (ConfigPtr->Channels[channel].Priority > GPT_MAX_PRIORITY))
+            {
+                Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_INIT_SID, GPT_E_PARAM_CONFIG);
+                error = TRUE;
+                break;
+            }
+            used_timers |= ((uint16)1 << hw_timer);
+        }
+    }
+#endif
+
+    /* In-case there are no errors */
+    if(FALSE == error)
+    {
+        Gpt_Channels = ConfigPtr->Channels; /* address of the first Channels structure --> Channels[0] */
+
+        for(hw_timer = 0; hw_timer < GPT_HW_TIMERS; hw_timer++)
+        {
+            Gpt_HwChannel[hw_timer] = GPT_NO_CHANNEL;
+        }
+
+        for(channel = 0; channel < GPT_CONFIGURED_CHANNELS; channel++)
+        {
+            hw_timer = Gpt_Channels[channel].Hw_Timer;
+            Gpt_HwChannel[hw_timer] = channel;
+
+            /* Enable the clock of the GPTM block and wait until its registers can be accessed,
+             * it stays clocked in the sleep modes so the channel keeps counting */
+            if(hw_timer < GPT_WIDE_TIMER_0)
+            {
+                Mcu_EnableTimerClocks((uint8)(1U << hw_timer), 0U);
+            }
+            else
+            {
+                Mcu_EnableTimerClocks(0U, (uint8)(1U << (hw_timer - GPT_WIDE_TIMER_0)));
+            }
+
+            /* Timer disabled, frozen while the debugger halts the CPU */
+            GPT_HW_REG(hw_timer, GPT_CTL_REG_OFFSET) = GPT_CTL_TASTALL_MASK;
+
+            /* 32-bit down counter: the whole 16/32-bit block or timer A of a wide block */
+            GPT_HW_REG(hw_timer, GPT_CFG_REG_OFFSET) = (hw_timer < GPT_WIDE_TIMER_0) ? GPT_CFG_CONCATENATED : GPT_CFG_SPLIT;
+            GPT_HW_REG(hw_timer, GPT_TAMR_REG_OFFSET) = (Gpt_Channels[channel].Mode == GPT_CH_MODE_ONESHOT) ? GPT_TAMR_ONE_SHOT : GPT_TAMR_PERIODIC;
+            GPT_HW_REG(hw_timer, GPT_TAPR_REG_OFFSET) = Gpt_ScaledPrescaler(&Gpt_Channels[channel]);
+
+            /* The time-out interrupt tracks the expiry of the one-shot channels and calls the notifications */
+            GPT_HW_REG(hw_timer, GPT_ICR_REG_OFFSET) = GPT_INT_TATO_MASK;
+            GPT_HW_REG(hw_timer, GPT_IMR_REG_OFFSET) = GPT_INT_TATO_MASK;
+            *((volatile uint8 *)GPT_NVIC_PRI_BASE_ADDRESS + Gpt_HwIrq[hw_timer]) = (uint8)(Gpt_Channels[channel].Priority << GPT_NVIC_PRIORITY_POS);
+            *((volatile uint32 *)GPT_NVIC_EN_BASE_ADDRESS + (Gpt_HwIrq[hw_timer] / 32U)) = (uint32)1 << (Gpt_HwIrq[hw_timer] % 32U);
+
+            Gpt_ChannelState[channel]        = GPT_CHANNEL_INITIALIZED;
+            Gpt_NotificationEnabled[channel] = FALSE;
+        }
+
+#if (GPT_TIMESTAMP_API == STD_ON)
+        Gpt_StartTimestamp();
+#endif
+
+        Gpt_Status = GPT_INITIALIZED;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+
+/************************************************************************************
+* Service Name: Gpt_DeInit
+* Service ID[hex]: 0x02
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to disable the GPTM blocks and their interrupts, no channel may run.
+************************************************************************************/
+#if (GPT_DEINIT_API == STD_ON)
+void Gpt_DeInit(void)
+{
+    Gpt_ChannelType channel;
+    Gpt_HwTimerType hw_timer;
+    boolean error = FALSE;
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+    /* Check if the Driver is initialized before using this function */
+    if (GPT_NOT_INITIALIZED == Gpt_Status)
+    {
+        Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_DEINIT_SID, GPT_E_UNINIT);
+        error = TRUE;
+    }
+    else
+    {
+        for(channel = 0; channel < GPT_CONFIGURED_CHANNELS; channel++)
+        {
+            if(GPT_CHANNEL_RUNNING == Gpt_ChannelState[channel])
+            {
+                Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_DEINIT_SID, GPT_E_BUSY);
+                error = TRUE;
+                break;
+            }
+        }
+    }
+#endif
+
+    /* In-case there are no errors */
+    if(FALSE == error)
+    {
+        for(channel = 0; channel < GPT_CONFIGURED_CHANNELS; channel++)
+        {
+            hw_timer = Gpt_Channels[channel].Hw_Timer;
+            GPT_HW_REG(hw_timer, GPT_CTL_REG_OFFSET) = 0;
+            GPT_HW_REG(hw_timer, GPT_IMR_REG_OFFSET) = 0;
+            GPT_HW_REG(hw_timer, GPT_ICR_REG_OFFSET) = GPT_INT_TATO_MASK;
+            *((volatile uint32 *)GPT_NVIC_DIS_BASE_ADDRESS + (Gpt_HwIrq[hw_timer] / 32U)) = (uint32)1 << (Gpt_HwIrq[hw_timer] % 32U);
+            Gpt_HwChannel[hw_timer] = GPT_NO_CHANNEL;
+            Gpt_NotificationEnabled[channel] = FALSE;
+        }
+        Gpt_Status = GPT_NOT_INITIALIZED;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+#endif
+
+/************************************************************************************
+* Service Name: Gpt_CheckChannel
+* Description: Report the use of the driver before its initialization or of an invalid channel
+************************************************************************************/
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+STATIC boolean Gpt_CheckChannel(Gpt_ChannelType Channel, uint8 ServiceId)
+{
+    boolean error = FALSE;
+
+    /* Check if the Driver is initialized before using this function */
+    if (GPT_NOT_INITIALIZED == Gpt_Status)
+    {
+        Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, ServiceId, GPT_E_UNINIT);
+        error = TRUE;
+    }
+    /* Check if the used channel is within the valid range */
+    else if (GPT_CONFIGURED_CHANNELS <= Channel)
+    {
+        Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, ServiceId, GPT_E_PARAM_CHANNEL);
+        error = TRUE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    return error;
+}
+#endif
+
+/************************************************************************************
+* Service Name: Gpt_RunningElapsed
+* Description: Ticks elapsed in the period in progress of a running channel, a one-shot
+*              channel which timed out before its interrupt was served counts its whole period
+************************************************************************************/
+STATIC Gpt_ValueType Gpt_RunningElapsed(Gpt_ChannelType Channel)
+{
+    Gpt_HwTimerType hw_timer = Gpt_Channels[Channel].Hw_Timer;
+
+    if((Gpt_Channels[Channel].Mode == GPT_CH_MODE_ONESHOT)
+       && (GPT_HW_REG(hw_timer, GPT_RIS_REG_OFFSET) & GPT_INT_TATO_MASK))
+    {
+        return Gpt_TargetTime[Channel];
+    }
+    /* The counter counts down from Value - 1 to 0 */
+    return (Gpt_TargetTime[Channel] - 1U) - GPT_HW_REG(hw_timer, GPT_TAR_REG_OFFSET);
+}
+
+/************************************************************************************
+* Service Name: Gpt_GetTimeElapsed
+* Service ID[hex]: 0x03
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - Numeric identifier of the GPT channel
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Gpt_ValueType - Ticks elapsed since the start (or the last expiry of a continuous
+*                               channel), the time at the stop of a stopped channel, the whole
+*                               period of an expired one-shot channel, 0 before the first start
+* Description: Function to get the time already elapsed.
+************************************************************************************/
+#if (GPT_TIME_ELAPSED_API == STD_ON)
+Gpt_ValueType Gpt_GetTimeElapsed(Gpt_ChannelType Channel)
+{
+    Gpt_ValueType elapsed = 0;
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+    if(Gpt_CheckChannel(Channel, GPT_GET_TIME_ELAPSED_SID))
+    {
+        return 0;
+    }
+#endif
+
+    switch(Gpt_ChannelState[Channel])
+    {
+        case GPT_CHANNEL_RUNNING:  elapsed = Gpt_RunningElapsed(Channel);
+                                   break;
+        case GPT_CHANNEL_STOPPED:  elapsed = Gpt_StopTime[Channel];
+                                   break;
+        case GPT_CHANNEL_EXPIRED:  elapsed = Gpt_TargetTime[Channel];
+                                   break;
+        default:                   /* Never started */
+                                   break;
+    }
+    return elapsed;
+}
+#endif
+
+/************************************************************************************
+* Service Name: Gpt_GetTimeRemaining
+* Service ID[hex]: 0x04
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - Numeric identifier of the GPT channel
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Gpt_ValueType - Ticks remaining until the next expiry, the remaining time at the
+*                               stop of a stopped channel, 0 for an expired one-shot channel
+*                               and before the first start
+* Description: Function to get the time remaining until the target time is reached.
+************************************************************************************/
+#if (GPT_TIME_REMAINING_API == STD_ON)
+Gpt_ValueType Gpt_GetTimeRemaining(Gpt_ChannelType Channel)
+{
+    Gpt_ValueType remaining = 0;
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+    if(Gpt_CheckChannel(Channel, GPT_GET_TIME_REMAINING_SID))
+    {
+        return 0;
+    }
+#endif
+
+    switch(Gpt_ChannelState[Channel])
+    {
+        case GPT_CHANNEL_RUNNING:  remaining = Gpt_TargetTime[Channel] - Gpt_RunningElapsed(Channel);
+                                   break;
+        case GPT_CHANNEL_STOPPED:  remaining = Gpt_TargetTime[Channel] - Gpt_StopTime[Channel];
+                                   break;
+        default:                   /* Expired or never started */
+                                   break;
+    }
+    return remaining;
+}
+#endif
+
+/************************************************************************************
+* Service Name: Gpt_StartTimer
+* Service ID[hex]: 0x05
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - Numeric identifier of the GPT channel
+*                  Value - Target time in ticks of the channel (1 tick = Prescaler + 1 system clocks)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to start a stopped or expired channel with the given target time.
+************************************************************************************/
+void Gpt_StartTimer(Gpt_ChannelType Channel, Gpt_ValueType Value)
+{
+    Gpt_HwTimerType hw_timer;
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+    if(Gpt_CheckChannel(Channel, GPT_START_TIMER_SID))
+    {
+        return;
+    }
+    if(0U == Value)
+    {
+        Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_START_TIMER_SID, GPT_E_PARAM_VALUE);
+        return;
+    }
+    if(GPT_CHANNEL_RUNNING == Gpt_ChannelState[Channel])
+    {
+        Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_START_TIMER_SID, GPT_E_BUSY);
+        return;
+    }
+#endif
+
+    hw_timer = Gpt_Channels[Channel].Hw_Timer;
+    Gpt_TargetTime[Channel] = Value;
+
+    /* The counter loads the interval when it is enabled and times out after Value ticks */
+    GPT_HW_REG(hw_timer, GPT_TAILR_REG_OFFSET) = Value - 1U;
+    GPT_HW_REG(hw_timer, GPT_ICR_REG_OFFSET)   = GPT_INT_TATO_MASK;
+    Gpt_ChannelState[Channel] = GPT_CHANNEL_RUNNING;
+    GPT_HW_REG(hw_timer, GPT_CTL_REG_OFFSET)  |= GPT_CTL_TAEN_MASK;
+}
+
+/************************************************************************************
+* Service Name: Gpt_StopTimer
+* Service ID[hex]: 0x06
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - Numeric identifier of the GPT channel
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to stop a running channel, nothing is done for a channel not running.
+************************************************************************************/
+void Gpt_StopTimer(Gpt_ChannelType Channel)
+{
+    Gpt_HwTimerType hw_timer;
+    Gpt_ValueType elapsed;
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+    if(Gpt_CheckChannel(Channel, GPT_STOP_TIMER_SID))
+    {
+        return;
+    }
+#endif
+
+    if(GPT_CHANNEL_RUNNING == Gpt_ChannelState[Channel])
+    {
+        hw_timer = Gpt_Channels[Channel].Hw_Timer;
+        elapsed  = Gpt_RunningElapsed(Channel);
+        GPT_HW_REG(hw_timer, GPT_CTL_REG_OFFSET) &= ~GPT_CTL_TAEN_MASK;
+        GPT_HW_REG(hw_timer, GPT_ICR_REG_OFFSET)  = GPT_INT_TATO_MASK;
+
+        /* A one-shot channel which already timed out is expired, not stopped */
+        Gpt_StopTime[Channel]     = elapsed;
+        Gpt_ChannelState[Channel] = (elapsed == Gpt_TargetTime[Channel]) ? GPT_CHANNEL_EXPIRED : GPT_CHANNEL_STOPPED;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+
+#if (GPT_ENABLE_DISABLE_NOTIFICATION_API == STD_ON)
+/************************************************************************************
+* Service Name: Gpt_SetNotification
+* Description: Enable or disable the notification of a channel which has one configured
+************************************************************************************/
+STATIC void Gpt_SetNotification(Gpt_ChannelType Channel, boolean Enabled, uint8 ServiceId)
+{
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+    if(Gpt_CheckChannel(Channel, ServiceId))
+    {
+        return;
+    }
+    if(NULL_PTR == Gpt_Channels[Channel].Notification)
+    {
+        Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, ServiceId, GPT_E_PARAM_CHANNEL);
+        return;
+    }
+#else
+    (void)ServiceId;
+#endif
+    Gpt_NotificationEnabled[Channel] = Enabled;
+}
+
+/************************************************************************************
+* Service Name: Gpt_EnableNotification
+* Service ID[hex]: 0x07
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - Numeric identifier of the GPT channel
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to call the configured notification at every expiry of the channel.
+************************************************************************************/
+void Gpt_EnableNotification(Gpt_ChannelType Channel)
+{
+    Gpt_SetNotification(Channel, TRUE, GPT_ENABLE_NOTIFICATION_SID);
+}
+
+/************************************************************************************
+* Service Name: Gpt_DisableNotification
+* Service ID[hex]: 0x08
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - Numeric identifier of the GPT channel
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to stop calling the notification of the channel.
+************************************************************************************/
+void Gpt_DisableNotification(Gpt_ChannelType Channel)
+{
+    Gpt_SetNotification(Channel, FALSE, GPT_DISABLE_NOTIFICATION_SID);
+}
+#endif
+
+/************************************************************************************
+* Service Name: Gpt_GetTimestampCycles
+* Service ID[hex]: 0x10
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint64 - System clocks counted since Gpt_Init, 0 before it
+* Description: Function to read the 64-bit free-running timestamp, it never wraps in practice
+*              and can be called from the interrupts (no lock, the two halves are read again
+*              when the lower one wrapped during the read). Gpt_DeInit keeps it counting.
+************************************************************************************/
+#if (GPT_TIMESTAMP_API == STD_ON)
+uint64 Gpt_GetTimestampCycles(void)
+{
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+    /* The timestamp may still be stopped before the first Gpt_Init */
+    if(FALSE == Gpt_TimestampStarted())
+    {
+        Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_GET_TIMESTAMP_CYCLES_SID, GPT_E_UNINIT);
+        return 0;
+    }
+#endif
+
+    return Gpt_ReadTimestamp();
+}
+
+/************************************************************************************
+* Service Name: Gpt_GetTimestampUs
+* Service ID[hex]: 0x11
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint64 - Microseconds counted since Gpt_Init, 0 before it
+* Description: Function to read the free-running timestamp in microseconds.
+************************************************************************************/
+uint64 Gpt_GetTimestampUs(void)
+{
+    return Gpt_GetTimestampCycles() / Gpt_TimestampCyclesPerUs;
+}
+#endif
+
+/************************************************************************************
+* Service Name: Gpt_GetPredefTimerValue
+* Service ID[hex]: 0x0D
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): PredefTimer - GPT Predef Timer
+* Parameters (inout): None
+* Parameters (out): TimeValuePtr - Pointer to where to store the current value of the timer
+* Return value: Std_ReturnType - E_OK: the value is stored
+*                                E_NOT_OK: the timer is disabled or not started yet
+* Description: Function to read the current value of a predefined timer, it can be called
+*              from the interrupts and counts on after Gpt_DeInit.
+************************************************************************************/
+#if (GPT_PREDEF_TIMER_API == STD_ON)
+Std_ReturnType Gpt_GetPredefTimerValue(Gpt_PredefTimerType PredefTimer, uint32 * TimeValuePtr)
+{
+    boolean error = FALSE;
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+    if(FALSE == Gpt_TimestampStarted())
+    {
+        Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_GET_PREDEF_TIMER_VALUE_SID, GPT_E_UNINIT);
+        error = TRUE;
+    }
+    else if(FALSE == Gpt_PredefTimerValid(PredefTimer))
+    {
+        Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_GET_PREDEF_TIMER_VALUE_SID, GPT_E_PARAM_PREDEF_TIMER);
+        error = TRUE;
+    }
+    else if(NULL_PTR == TimeValuePtr)
+    {
+        Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_GET_PREDEF_TIMER_VALUE_SID, GPT_E_PARAM_POINTER);
+        error = TRUE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+#endif
+
+    /* In-case there are no errors */
+    if(FALSE == error)
+    {
+        *TimeValuePtr = Gpt_PredefTimerNow(PredefTimer);
+        return E_OK;
+    }
+    else
+    {
+        return E_NOT_OK;
+    }
+}
+
+/************************************************************************************
+* Service Name: Gpt_DeadlineReached
+* Service ID[hex]: 0x12
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): PredefTimer - GPT Predef Timer
+*                  StartValue - Value of the timer at the start of the wait (Gpt_GetPredefTimerValue)
+*                  Duration - Time to wait in ticks of the timer, shorter than its wrap
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - TRUE: Duration ticks elapsed since StartValue (or invalid parameters)
+*                         FALSE: the deadline is still ahead
+* Description: Function to poll a deadline without blocking, the wrap of the timer is handled.
+*              Invalid parameters report the deadline as reached so no caller waits forever.
+************************************************************************************/
+boolean Gpt_DeadlineReached(Gpt_PredefTimerType PredefTimer, uint32 StartValue, uint32 Duration)
+{
+    boolean error = FALSE;
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+    if(FALSE == Gpt_TimestampStarted())
+    {
+        Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_DEADLINE_REACHED_SID, GPT_E_UNINIT);
+        error = TRUE;
+    }
+    else if(FALSE == Gpt_PredefTimerValid(PredefTimer))
+    {
+        Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_DEADLINE_REACHED_SID, GPT_E_PARAM_PREDEF_TIMER);
+        error = TRUE;
+    }
+    else if(Duration > Gpt_PredefTimerMask[PredefTimer])
+    {
+        Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_DEADLINE_REACHED_SID, GPT_E_PARAM_VALUE);
+        error = TRUE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+#endif
+
+    /* In-case there are no errors */
+    if(FALSE == error)
+    {
+        return (((Gpt_PredefTimerNow(PredefTimer) - StartValue) & Gpt_PredefTimerMask[PredefTimer]) >= Duration) ? TRUE : FALSE;
+    }
+    else
+    {
+        return TRUE;
+    }
+}
+#endif
+
+/************************************************************************************
+* Service Name: Gpt_DelayUs
+* Service ID[hex]: 0x13
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Delay - Time to wait in microseconds
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to wait a short time measured by the timestamp. The CPU sleeps (WFI)
+*              until the timestamp match interrupt of the deadline, the other interrupts still
+*              run meanwhile. The tasks they activate only run meanwhile when they preempt the
+*              caller (OS_PREEMPTIVE_MODE), the cooperative scheduler runs them once the delay
+*              ends. From an interrupt handler or with the interrupts masked (PRIMASK) the
+*              deadline is polled and the interrupt mask of the caller is kept.
+************************************************************************************/
+#if (GPT_DELAY_API == STD_ON)
+void Gpt_DelayUs(uint32 Delay)
+{
+    uint64 deadline;
+    boolean error = FALSE;
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+    if(FALSE == Gpt_TimestampStarted())
+    {
+        Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_DELAY_US_SID, GPT_E_UNINIT);
+        error = TRUE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+#endif
+
+    /* In-case there are no errors */
+    if(FALSE == error)
+    {
+        deadline = Gpt_ReadTimestamp() + ((uint64)Delay * Gpt_TimestampCyclesPerUs);
+
+        if((NVIC_SYSTEM_INTCTRL & GPT_VECTACTIVE_MASK) || (Gpt_PortGetPrimask() != 0))
+        {
+            /* The wake-up interrupt may not preempt the running handler nor run while the caller
+             * masks the interrupts */
+            while(Gpt_ReadTimestamp() < deadline);
+        }
+        else
+        {
+            /* The caller runs with the interrupts enabled, they are enabled again at the end.
+             * The match is set before the deadline is checked with the interrupts disabled,
+             * a deadline passed in between leaves the interrupt pending and WFI returns */
+            Gpt_Disable_Interrupts();
+            Gpt_ArmWakeUp(deadline);
+            while(Gpt_ReadTimestamp() < deadline)
+            {
+                Gpt_Wait_For_Interrupt();
+                Gpt_Enable_Interrupts();    /* The waking interrupt runs here */
+                Gpt_Disable_Interrupts();
+                Gpt_ArmWakeUp(deadline);    /* A nested Gpt_DelayUs may have moved the match */
+            }
+            Gpt_Enable_Interrupts();
+        }
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+#endif
+
+/************************************************************************************
+* Service Name: Gpt_GetVersionInfo
+* Service ID[hex]: 0x00
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): VersionInfo - Pointer to where to store the version information of this module.
+* Return value: None
+* Description: Function to get the version information of this module.
+************************************************************************************/
+#if (GPT_VERSION_INFO_API == STD_ON)
+void Gpt_GetVersionInfo(Std_VersionInfoType * VersionInfo)
+{
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+    /* Check if input pointer is not Null pointer */
+    if(NULL_PTR == VersionInfo)
+    {
+        /* Report to DET  */
+        Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_GET_VERSION_INFO_SID, GPT_E_PARAM_POINTER);
+    }
+    else
+#endif /* (GPT_DEV_ERROR_DETECT == STD_ON) */
+    {
+        /* Copy the vendor Id */
+        VersionInfo->vendorID = (uint16)GPT_VENDOR_ID;
+        /* Copy the module Id */
+        VersionInfo->moduleID = (uint16)GPT_MODULE_ID;
+        /* Copy Software Major Version */
+        VersionInfo->sw_major_version = (uint8)GPT_SW_MAJOR_VERSION;
+        /* Copy Software Minor Version */
+        VersionInfo->sw_minor_version = (uint8)GPT_SW_MINOR_VERSION;
+        /* Copy Software Patch Version */
+        VersionInfo->sw_patch_version = (uint8)GPT_SW_PATCH_VERSION;
+    }
+}
+#endif
+
+/************************************************************************************
+* Service Name: Gpt_TimeoutIsr
+* Description: Time-out interrupt of a GPTM block: a one-shot channel expires (the hardware
+*              already disabled it) and the notification is called when enabled.
+*              On the timestamp block it is the match interrupt of Gpt_DelayUs.
+************************************************************************************/
+STATIC void Gpt_TimeoutIsr(Gpt_HwTimerType HwTimer)
+{
+    Gpt_ChannelType channel = Gpt_HwChannel[HwTimer];
+
+    GPT_HW_REG(HwTimer, GPT_ICR_REG_OFFSET) = GPT_INT_TATO_MASK;
+
+#if (GPT_DELAY_API == STD_ON)
+    if(GPT_TIMESTAMP_HW_TIMER == HwTimer)
+    {
+        /* Timestamp match: it only wakes Gpt_DelayUs which checks its own deadline */
+        GPT_HW_REG(HwTimer, GPT_IMR_REG_OFFSET) = 0;
+        GPT_HW_REG(HwTimer, GPT_ICR_REG_OFFSET) = GPT_INT_TAM_MASK;
+    }
+#endif
+
+    if(channel != GPT_NO_CHANNEL)
+    {
+        if(Gpt_Channels[channel].Mode == GPT_CH_MODE_ONESHOT)
+        {
+            Gpt_ChannelState[channel] = GPT_CHANNEL_EXPIRED;
+        }
+        if(Gpt_NotificationEnabled[channel])
+        {
+            Gpt_Channels[channel].Notification();
+        }
+    }
+}
+
+/************************************************************************************
+* Service Name: TimerxA_Handler, WideTimerxA_Handler
+* Description: Timer A ISRs of the GPTM blocks (vector table in tm4c123gh6pm_startup_ccs.c)
+************************************************************************************/
+void Timer0A_Handler(void)     { Gpt_TimeoutIsr(GPT_TIMER_0); }
+void Timer1A_Handler(void)     { Gpt_TimeoutIsr(GPT_TIMER_1); }
+void Timer2A_Handler(void)     { Gpt_TimeoutIsr(GPT_TIMER_2); }
+void Timer3A_Handler(void)     { Gpt_TimeoutIsr(GPT_TIMER_3); }
+void Timer4A_Handler(void)     { Gpt_TimeoutIsr(GPT_TIMER_4); }
+void Timer5A_Handler(void)     { Gpt_TimeoutIsr(GPT_TIMER_5); }
+void WideTimer0A_Handler(void) { Gpt_TimeoutIsr(GPT_WIDE_TIMER_0); }
+void WideTimer1A_Handler(void) { Gpt_TimeoutIsr(GPT_WIDE_TIMER_1); }
+void WideTimer2A_Handler(void) { Gpt_TimeoutIsr(GPT_WIDE_TIMER_2); }
+void WideTimer3A_Handler(void) { Gpt_TimeoutIsr(GPT_WIDE_TIMER_3); }
+void WideTimer4A_Handler(void) { Gpt_TimeoutIsr(GPT_WIDE_TIMER_4); }
+void WideTimer5A_Handler(void) { Gpt_TimeoutIsr(GPT_WIDE_TIMER_5); }
@@ -4,7 +4,8 @@
  *
  * File Name: Gpt.h
  *
- * Description: Header file for TM4C123GH6PM Microcontroller - SysTick Timer Driver.
+ * Description: Header file for TM4C123GH6PM Microcontroller - Gpt Driver
+ *              (GPTM 16/32-bit and 32/64-bit wide timers, SysTick Timer of the Os).
  *
  * Author: Yahia Hamimi
  ******************************************************************************/
@@ -12,25 +13,485 @@
 #ifndef GPT_H
 #define GPT_H
 
+/* Id for the company in the AUTOSAR
+ * for example yahia's ID = 1000 :) */
+#define GPT_VENDOR_ID    (1000U)
+
+/* Gpt Module Id */
+#define GPT_MODULE_ID    (100U)
+
+/* Gpt Instance Id */
+#define GPT_INSTANCE_ID  (0U)
+
+/*
+ * Module Version 1.0.0
+ */
+#define GPT_SW_MAJOR_VERSION           (1U)
+#define GPT_SW_MINOR_VERSION           (0U)
+#define GPT_SW_PATCH_VERSION           (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define GPT_AR_RELEASE_MAJOR_VERSION   (4U)
+#define GPT_AR_RELEASE_MINOR_VERSION   (0U)
+#define GPT_AR_RELEASE_PATCH_VERSION   (3U)
+
+/*
+ * Macros for Gpt Status
+ */
+#define GPT_INITIALIZED                (1U)
+#define GPT_NOT_INITIALIZED            (0U)
+
+/*
+ * Enabling grades of the 1 us predefined timers (GPT_PREDEF_TIMER_1US_ENABLING_GRADE)
+ */
+#define GPT_PREDEF_TIMER_1US_DISABLED              (0U)
+#define GPT_PREDEF_TIMER_1US_16BIT_ENABLED         (1U)
+#define GPT_PREDEF_TIMER_1US_16_24BIT_ENABLED      (2U)
+#define GPT_PREDEF_TIMER_1US_16_24_32BIT_ENABLED   (3U)
+
+/* Standard AUTOSAR types */
 #include "Std_Types.h"
 
+/* AUTOSAR checking between Std Types and Gpt Modules */
+#if ((STD_TYPES_AR_RELEASE_MAJOR_VERSION != GPT_AR_RELEASE_MAJOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_MINOR_VERSION != GPT_AR_RELEASE_MINOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_PATCH_VERSION != GPT_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Std_Types.h does not match the expected version"
+#endif
+
+/* Mcu Driver: system clock of the SysTick Timer and the GPTM blocks */
+#include "Mcu.h"
+
+/* Gpt Pre-Compile Configuration Header file */
+#include "Gpt_Cfg.h"
+
+/* AUTOSAR Version checking between Gpt_Cfg.h and Gpt.h files */
+#if ((GPT_CFG_AR_RELEASE_MAJOR_VERSION != GPT_AR_RELEASE_MAJOR_VERSION)\
+ ||  (GPT_CFG_AR_RELEASE_MINOR_VERSION != GPT_AR_RELEASE_MINOR_VERSION)\
+ ||  (GPT_CFG_AR_RELEASE_PATCH_VERSION != GPT_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Gpt_Cfg.h does not match the expected version"
+#endif
+
+/* Software Version checking between Gpt_Cfg.h and Gpt.h files */
+#if ((GPT_CFG_SW_MAJOR_VERSION != GPT_SW_MAJOR_VERSION)\
+ ||  (GPT_CFG_SW_MINOR_VERSION != GPT_SW_MINOR_VERSION)\
+ ||  (GPT_CFG_SW_PATCH_VERSION != GPT_SW_PATCH_VERSION))
+  #error "The SW version of Gpt_Cfg.h does not match the expected version"
+#endif
+
+#if ((GPT_CONFIGURED_CHANNELS == 0U) || (GPT_CONFIGURED_CHANNELS > 12U))
+  #error "Between 1 and 12 Gpt Channels must be configured, one per GPTM block"
+#endif
+
+#if ((GPT_TIMESTAMP_API == STD_ON) && (GPT_TIMESTAMP_WIDE_TIMER > 5U))
+  #error "The timestamp needs one of the 6 wide GPTM blocks"
+#endif
+
+/* The predefined timers are read from the timestamp */
+#if ((GPT_PREDEF_TIMER_1US_ENABLING_GRADE != GPT_PREDEF_TIMER_1US_DISABLED) || (GPT_PREDEF_TIMER_100US_32BIT_ENABLE == STD_ON))
+#define GPT_PREDEF_TIMER_API           (STD_ON)
+#else
+#define GPT_PREDEF_TIMER_API           (STD_OFF)
+#endif
+
+#if (((GPT_PREDEF_TIMER_API == STD_ON) || (GPT_DELAY_API == STD_ON)) && (GPT_TIMESTAMP_API == STD_OFF))
+  #error "The predefined timers and Gpt_DelayUs need the timestamp (GPT_TIMESTAMP_API)"
+#endif
+
+#if (GPT_PREDEF_TIMER_1US_ENABLING_GRADE > GPT_PREDEF_TIMER_1US_16_24_32BIT_ENABLED)
+  #error "Invalid GPT_PREDEF_TIMER_1US_ENABLING_GRADE"
+#endif
+
+/******************************************************************************
+ *                      API Service Id Macros                                 *
+ ******************************************************************************/
+/* Service ID for Gpt GetVersionInfo */
+#define GPT_GET_VERSION_INFO_SID       (uint8)0x00
+
+/* Service ID for Gpt Init */
+#define GPT_INIT_SID                   (uint8)0x01
+
+/* Service ID for Gpt DeInit */
+#define GPT_DEINIT_SID                 (uint8)0x02
+
+/* Service ID for Gpt GetTimeElapsed */
+#define GPT_GET_TIME_ELAPSED_SID       (uint8)0x03
+
+/* Service ID for Gpt GetTimeRemaining */
+#define GPT_GET_TIME_REMAINING_SID     (uint8)0x04
+
+/* Service ID for Gpt StartTimer */
+#define GPT_START_TIMER_SID            (uint8)0x05
+
+/* Service ID for Gpt StopTimer */
+#define GPT_STOP_TIMER_SID             (uint8)0x06
+
+/* Service ID for Gpt EnableNotification */
+#define GPT_ENABLE_NOTIFICATION_SID    (uint8)0x07
+
+/* Service ID for Gpt DisableNotification */
+#define GPT_DISABLE_NOTIFICATION_SID   (uint8)0x08
+
+/* Service ID for Gpt GetPredefTimerValue */
+#define GPT_GET_PREDEF_TIMER_VALUE_SID (uint8)0x0D
+
+/* Service ID for Gpt GetTimestampCycles */
+#define GPT_GET_TIMESTAMP_CYCLES_SID   (uint8)0x10
+
+/* Service ID for Gpt GetTimestampUs */
+#define GPT_GET_TIMESTAMP_US_SID       (uint8)0x11
+
+/* Service ID for Gpt DeadlineReached */
+#define GPT_DEADLINE_REACHED_SID       (uint8)0x12
+
+/* Service ID for Gpt DelayUs */
+#define GPT_DELAY_US_SID               (uint8)0x13
+
+/*******************************************************************************
+ *                      DET Error Codes                                        *
+ *******************************************************************************/
+/* API service used without module initialization */
+#define GPT_E_UNINIT                   (uint8)0x0A
+
+/* Gpt_StartTimer called on a running channel or Gpt_DeInit called while a channel runs */
+#define GPT_E_BUSY                     (uint8)0x0B
+
+/* Gpt_Init called while the driver is already initialized */
+#define GPT_E_ALREADY_INITIALIZED      (uint8)0x0D
+
+/* Gpt_Init called with a NULL pointer or an invalid channel configuration */
+#define GPT_E_PARAM_CONFIG             (uint8)0x0E
+
+/* DET code to report an invalid Channel */
+#define GPT_E_PARAM_CHANNEL            (uint8)0x14
+
+/* DET code to report a timeout value of 0 */
+#define GPT_E_PARAM_VALUE              (uint8)0x15
+
+/* DET code to report a NULL pointer parameter */
+#define GPT_E_PARAM_POINTER            (uint8)0x16
+
+/* DET code to report an invalid or disabled predefined timer */
+#define GPT_E_PARAM_PREDEF_TIMER       (uint8)0x17
+
+/*******************************************************************************
+ *                      Hardware Timers                                        *
+ *******************************************************************************/
+/* GPTM blocks which can drive a channel: a 16/32-bit block runs as one 32-bit timer clocked
+ * by the system clock, a wide block runs its 32-bit timer A behind a 16-bit prescaler */
+#define GPT_TIMER_0                    (Gpt_HwTimerType)0
+#define GPT_TIMER_1                    (Gpt_HwTimerType)1
+#define GPT_TIMER_2                    (Gpt_HwTimerType)2
+#define GPT_TIMER_3                    (Gpt_HwTimerType)3
+#define GPT_TIMER_4                    (Gpt_HwTimerType)4
+#define GPT_TIMER_5                    (Gpt_HwTimerType)5
+#define GPT_WIDE_TIMER_0               (Gpt_HwTimerType)6
+#define GPT_WIDE_TIMER_1               (Gpt_HwTimerType)7
+#define GPT_WIDE_TIMER_2               (Gpt_HwTimerType)8
+#define GPT_WIDE_TIMER_3               (Gpt_HwTimerType)9
+#define GPT_WIDE_TIMER_4               (Gpt_HwTimerType)10
+#define GPT_WIDE_TIMER_5               (Gpt_HwTimerType)11
+
+/* Number of GPTM blocks */
+#define GPT_HW_TIMERS                  (12U)
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Type definition for Gpt_ChannelType used by the Gpt APIs */
+typedef uint8 Gpt_ChannelType;
+
+/* Type definition for Gpt_ValueType used by the Gpt APIs (ticks of the channel) */
+typedef uint32 Gpt_ValueType;
+
+/* Type definition for Gpt_HwTimerType used by the channel configuration (GPT_TIMER_x, GPT_WIDE_TIMER_x) */
+typedef uint8 Gpt_HwTimerType;
+
+/* Type definition for Gpt_NotificationType: function called from the interrupt at every expiry */
+typedef void (*Gpt_NotificationType)(void);
+
+/* Type definition for Gpt_PredefTimerType: free-running timers counting from the timestamp,
+ * every one wraps at its own width */
+typedef enum
+{
+    GPT_PREDEF_TIMER_1US_16BIT,     /* 1 us ticks, wraps after 65.5 ms */
+    GPT_PREDEF_TIMER_1US_24BIT,     /* 1 us ticks, wraps after 16.7 s */
+    GPT_PREDEF_TIMER_1US_32BIT,     /* 1 us ticks, wraps after 71.5 minutes */
+    GPT_PREDEF_TIMER_100US_32BIT    /* 100 us ticks, wraps after 4.9 days */
+} Gpt_PredefTimerType;
+
+/* Type definition for Gpt_ChannelModeType used by the channel configuration */
+typedef enum
+{
+    GPT_CH_MODE_CONTINUOUS,  /* The channel restarts at every expiry */
+    GPT_CH_MODE_ONESHOT      /* The channel stops at the first expiry */
+} Gpt_ChannelModeType;
+
+/* Description: Structure to configure each individual channel:
+ *  1. The GPTM block driving the channel
+ *  2. The mode: continuous or one-shot
+ *  3. The prescaler: the channel counts every (Prescaler + 1) clocks of GPT_SYSTEM_CLOCK_HZ, wide
+ *     blocks only (scaled by Gpt_Init to the system clock of the Mcu Driver)
+ *  4. The NVIC priority of the interrupt (0 to 7)
+ *  5. The notification function or NULL_PTR
+ */
+typedef struct
+{
+    Gpt_HwTimerType Hw_Timer;
+    Gpt_ChannelModeType Mode;
+    uint16 Prescaler;
+    uint8 Priority;
+    Gpt_NotificationType Notification;
+} Gpt_ConfigChannel;
+
+/* Data Structure required for initializing the Gpt Driver */
+typedef struct Gpt_ConfigType
+{
+    Gpt_ConfigChannel Channels[GPT_CONFIGURED_CHANNELS];
+} Gpt_ConfigType;
+
 /*******************************************************************************
  *                      Function Prototypes                                    *
  *******************************************************************************/
 
+/************************************************************************************
+* Service Name: Gpt_Init
+* Service ID[hex]: 0x01
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): ConfigPtr - Pointer to post-build configuration data
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to Initialize the Gpt module: enable the clock of the GPTM block of
+*              every channel, configure its mode and prescaler and enable its interrupt.
+*              The channels are stopped and their notifications disabled.
+************************************************************************************/
+void Gpt_Init(const Gpt_ConfigType * ConfigPtr);
+
+#if (GPT_DEINIT_API == STD_ON)
+/************************************************************************************
+* Service Name: Gpt_DeInit
+* Service ID[hex]: 0x02
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to disable the GPTM blocks and their interrupts, no channel may run.
+************************************************************************************/
+void Gpt_DeInit(void);
+#endif
+
+#if (GPT_TIME_ELAPSED_API == STD_ON)
+/************************************************************************************
+* Service Name: Gpt_GetTimeElapsed
+* Service ID[hex]: 0x03
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - Numeric identifier of the GPT channel
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Gpt_ValueType - Ticks elapsed since the start (or the last expiry of a continuous
+*                               channel), the time at the stop of a stopped channel, the whole
+*                               period of an expired one-shot channel, 0 before the first start
+* Description: Function to get the time already elapsed.
+************************************************************************************/
+Gpt_ValueType Gpt_GetTimeElapsed(Gpt_ChannelType Channel);
+#endif
+
+#if (GPT_TIME_REMAINING_API == STD_ON)
+/************************************************************************************
+* Service Name: Gpt_GetTimeRemaining
+* Service ID[hex]: 0x04
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - Numeric identifier of the GPT channel
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Gpt_ValueType - Ticks remaining until the next expiry, the remaining time at the
+*                               stop of a stopped channel, 0 for an expired one-shot channel
+*                               and before the first start
+* Description: Function to get the time remaining until the target time is reached.
+************************************************************************************/
+Gpt_ValueType Gpt_GetTimeRemaining(Gpt_ChannelType Channel);
+#endif
+
+/************************************************************************************
+* Service Name: Gpt_StartTimer
+* Service ID[hex]: 0x05
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - Numeric identifier of the GPT channel
+*                  Value - Target time in ticks of the channel (1 tick = Prescaler + 1 system clocks)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to start a stopped or expired channel with the given target time.
+************************************************************************************/
+void Gpt_StartTimer(Gpt_ChannelType Channel, Gpt_ValueType Value);
+
+/************************************************************************************
+* Service Name: Gpt_StopTimer
+* Service ID[hex]: 0x06
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - Numeric identifier of the GPT channel
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to stop a running channel, nothing is done for a channel not running.
+************************************************************************************/
+void Gpt_StopTimer(Gpt_ChannelType Channel);
+
+#if (GPT_ENABLE_DISABLE_NOTIFICATION_API == STD_ON)
+/************************************************************************************
+* Service Name: Gpt_EnableNotification
+* Service ID[hex]: 0x07
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - Numeric identifier of the GPT channel
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to call the configured notification at every expiry of the channel.
+************************************************************************************/
+void Gpt_EnableNotification(Gpt_ChannelType Channel);
+
+/************************************************************************************
+* Service Name: Gpt_DisableNotification
+* Service ID[hex]: 0x08
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - Numeric identifier of the GPT channel
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to stop calling the notification of the channel.
+************************************************************************************/
+void Gpt_DisableNotification(Gpt_ChannelType Channel);
+#endif
+
+#if (GPT_TIMESTAMP_API == STD_ON)
+/************************************************************************************
+* Service Name: Gpt_GetTimestampCycles
+* Service ID[hex]: 0x10
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint64 - System clocks counted since Gpt_Init, 0 before it
+* Description: Function to read the 64-bit free-running timestamp, it never wraps in practice
+*              and can be called from the interrupts (no lock, the two halves are read again
+*              when the lower one wrapped during the read). Gpt_DeInit keeps it counting.
+************************************************************************************/
+uint64 Gpt_GetTimestampCycles(void);
+
+/************************************************************************************
+* Service Name: Gpt_GetTimestampUs
+* Service ID[hex]: 0x11
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint64 - Microseconds counted since Gpt_Init, 0 before it
+* Description: Function to read the free-running timestamp in microseconds.
+************************************************************************************/
+uint64 Gpt_GetTimestampUs(void);
+#endif
+
+#if (GPT_PREDEF_TIMER_API == STD_ON)
+/************************************************************************************
+* Service Name: Gpt_GetPredefTimerValue
+* Service ID[hex]: 0x0D
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): PredefTimer - GPT Predef Timer
+* Parameters (inout): None
+* Parameters (out): TimeValuePtr - Pointer to where to store the current value of the timer
+* Return value: Std_ReturnType - E_OK: the value is stored
+*                                E_NOT_OK: the timer is disabled or not started yet
+* Description: Function to read the current value of a predefined timer, it can be called
+*              from the interrupts and counts on after Gpt_DeInit.
+************************************************************************************/
+Std_ReturnType Gpt_GetPredefTimerValue(Gpt_PredefTimerType PredefTimer, uint32 * TimeValuePtr);
+
+/************************************************************************************
+* Service Name: Gpt_DeadlineReached
+* Service ID[hex]: 0x12
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): PredefTimer - GPT Predef Timer
+*                  StartValue - Value of the timer at the start of the wait (Gpt_GetPredefTimerValue)
+*                  Duration - Time to wait in ticks of the timer, shorter than its wrap
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - TRUE: Duration ticks elapsed since StartValue (or invalid parameters)
+*                         FALSE: the deadline is still ahead
+* Description: Function to poll a deadline without blocking, the wrap of the timer is handled.
+************************************************************************************/
+boolean Gpt_DeadlineReached(Gpt_PredefTimerType PredefTimer, uint32 StartValue, uint32 Duration);
+#endif
+
+#if (GPT_DELAY_API == STD_ON)
+/************************************************************************************
+* Service Name: Gpt_DelayUs
+* Service ID[hex]: 0x13
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Delay - Time to wait in microseconds
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to wait a short time measured by the timestamp. The CPU sleeps (WFI)
+*              until the timestamp match interrupt of the deadline, the other interrupts still
+*              run meanwhile. The tasks they activate only run meanwhile when they preempt the
+*              caller (OS_PREEMPTIVE_MODE), the cooperative scheduler runs them once the delay
+*              ends. From an interrupt handler or with the interrupts masked (PRIMASK) the
+*              deadline is polled and the interrupt mask of the caller is kept.
+************************************************************************************/
+void Gpt_DelayUs(uint32 Delay);
+#endif
+
+#if (GPT_VERSION_INFO_API == STD_ON)
+/************************************************************************************
+* Service Name: Gpt_GetVersionInfo
+* Service ID[hex]: 0x00
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): VersionInfo - Pointer to where to store the version information of this module.
+* Return value: None
+* Description: Function to get the version information of this module.
+************************************************************************************/
+void Gpt_GetVersionInfo(Std_VersionInfoType * VersionInfo);
+#endif
+
+/*******************************************************************************
+ *                      SysTick Timer (Os tick)                                *
+ *******************************************************************************/
+
 /************************************************************************************
 * Service Name: SysTick_Start
 * Sync/Async: Synchronous
-* Reentrancy: reentrant
-* Parameters (in): Tick_Time - Time in miliseconds
+* Reentrancy: Non reentrant
+* Parameters (in): Tick_Time - Time in miliseconds (1 to 65535)
 * Parameters (inout): None
 * Parameters (out): None
 * Return value: None
 * Description: Function to Setup the SysTick Timer configuration to count n miliseconds:
-*              - Set the Reload value
-*              - Enable SysTick Timer with System clock 16Mhz
+*              - Set the Reload value from the system clock of the Mcu Driver, periods
+*                longer than the 24-bit reload range are counted in chunks
+*              - Enable SysTick Timer with the System clock
 *              - Enable SysTick Timer Interrupt and set its priority
-************************************************************************************/	
+************************************************************************************/
 void SysTick_Start(uint16 Tick_Time);
 
 /************************************************************************************
@@ -45,6 +506,23 @@ void SysTick_Start(uint16 Tick_Time);
 ************************************************************************************/
 void SysTick_Stop(void);
 
+/************************************************************************************
+* Service Name: SysTick_SetNextTime
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Tick_Time - Time in miliseconds (1 to 65535)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_OK: the next period will count Tick_Time
+*                                E_NOT_OK: the counter is about to wrap (or already wrapped)
+*                                          so the next period is left unchanged
+* Description: Function to change the length of the next SysTick period without
+*              disturbing the period in progress (the reload value is only used
+*              by the hardware when the counter wraps). Must be called with the
+*              interrupts disabled.
+************************************************************************************/
+Std_ReturnType SysTick_SetNextTime(uint16 Tick_Time);
+
 /************************************************************************************
 * Service Name: SysTick_SetCallBack
 * Sync/Async: Synchronous
@@ -57,4 +535,11 @@ void SysTick_Stop(void);
 ************************************************************************************/
 void SysTick_SetCallBack(void (*Ptr2Func)(void));
 
+/*******************************************************************************
+ *                       External Variables                                    *
+ *******************************************************************************/
+
+/* Extern PB structures to be used by Gpt */
+extern const Gpt_ConfigType Gpt_Configuration;
+
 #endif /* GPT_H */
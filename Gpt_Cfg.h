@@ -0,0 +1,74 @@
+ /******************************************************************************
+ *
+ * Module: Gpt
+ *
+ * File Name: Gpt_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for TM4C123GH6PM Microcontroller - Gpt Driver
+ *
+ * Author: Yahia Hamimi
+ ******************************************************************************/
+
+#ifndef GPT_CFG_H
+#define GPT_CFG_H
+
+/*
+ * Module Version 1.0.0
+ */
+#define GPT_CFG_SW_MAJOR_VERSION              (1U)
+#define GPT_CFG_SW_MINOR_VERSION              (0U)
+#define GPT_CFG_SW_PATCH_VERSION              (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define GPT_CFG_AR_RELEASE_MAJOR_VERSION     (4U)
+#define GPT_CFG_AR_RELEASE_MINOR_VERSION     (0U)
+#define GPT_CFG_AR_RELEASE_PATCH_VERSION     (3U)
+
+/* System clock in Hz the channel prescalers of Gpt_PBcfg.c are written for, Gpt_Init scales
+ * them to Mcu_GetClockFrequency (the SysTick and the timestamp use the run time clock only) */
+#define GPT_SYSTEM_CLOCK_HZ                  (MCU_SYSTEM_CLOCK_HZ)
+
+/* Pre-compile option for Development Error Detect */
+#define GPT_DEV_ERROR_DETECT                 (STD_ON)
+
+/* Pre-compile option for Version Info API */
+#define GPT_VERSION_INFO_API                 (STD_OFF)
+
+/* Pre-compile option for presence of Gpt_DeInit API */
+#define GPT_DEINIT_API                       (STD_ON)
+
+/* Pre-compile option for presence of Gpt_GetTimeElapsed API */
+#define GPT_TIME_ELAPSED_API                 (STD_ON)
+
+/* Pre-compile option for presence of Gpt_GetTimeRemaining API */
+#define GPT_TIME_REMAINING_API               (STD_ON)
+
+/* Pre-compile option for presence of Gpt_EnableNotification and Gpt_DisableNotification APIs */
+#define GPT_ENABLE_DISABLE_NOTIFICATION_API  (STD_ON)
+
+/* Pre-compile option for the free-running timestamp: Gpt_GetTimestampCycles and Gpt_GetTimestampUs */
+#define GPT_TIMESTAMP_API                    (STD_ON)
+
+/* Wide GPTM block (0 to 5) counting the timestamp, it cannot drive a channel */
+#define GPT_TIMESTAMP_WIDE_TIMER             (5U)
+
+/* Pre-compile option for the 1 us predefined timers (read from the timestamp):
+ * GPT_PREDEF_TIMER_1US_DISABLED, GPT_PREDEF_TIMER_1US_16BIT_ENABLED,
+ * GPT_PREDEF_TIMER_1US_16_24BIT_ENABLED or GPT_PREDEF_TIMER_1US_16_24_32BIT_ENABLED */
+#define GPT_PREDEF_TIMER_1US_ENABLING_GRADE  (GPT_PREDEF_TIMER_1US_16_24_32BIT_ENABLED)
+
+/* Pre-compile option for the 100 us 32-bit predefined timer (read from the timestamp) */
+#define GPT_PREDEF_TIMER_100US_32BIT_ENABLE  (STD_ON)
+
+/* Pre-compile option for presence of Gpt_DelayUs API (sleeps on the timestamp match interrupt) */
+#define GPT_DELAY_API                        (STD_ON)
+
+/* Number of the configured Gpt Channels */
+#define GPT_CONFIGURED_CHANNELS              (1U)
+
+/* Channel Index in the array of structures in Gpt_PBcfg.c */
+#define GptConf_FAST_CHANNEL_ID_INDEX        (Gpt_ChannelType)0x00
+
+#endif /* GPT_CFG_H */
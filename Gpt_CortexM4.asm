@@ -0,0 +1,28 @@
+;******************************************************************************
+;
+; Module: Gpt
+;
+; File Name: Gpt_CortexM4.asm
+;
+; Description: Cortex-M4F special register access used by the Gpt Driver.
+;
+; Author: Yahia Hamimi
+;******************************************************************************
+
+        .thumb
+        .text
+        .align  2
+
+        .global Gpt_PortGetPrimask
+
+;******************************************************************************
+; Service Name: Gpt_PortGetPrimask
+; Parameters (in): None
+; Return value: R0 - PRIMASK, 1 while the interrupts are masked
+; Description: Tell whether the caller runs with the interrupts masked.
+;******************************************************************************
+Gpt_PortGetPrimask:
+        MRS     R0, PRIMASK
+        BX      LR
+
+        .end
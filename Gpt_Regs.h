@@ -0,0 +1,80 @@
+ /******************************************************************************
+ *
+ * Module: Gpt
+ *
+ * File Name: Gpt_Regs.h
+ *
+ * Description: Header file for TM4C123GH6PM Microcontroller - Gpt Driver Registers
+ *
+ * Author: Yahia Hamimi
+ ******************************************************************************/
+
+#ifndef GPT_REGS_H
+#define GPT_REGS_H
+
+#include "Std_Types.h"
+
+/* 16/32-bit GPTM blocks base addresses */
+#define GPT_TIMER0_BASE_ADDRESS           0x40030000
+#define GPT_TIMER1_BASE_ADDRESS           0x40031000
+#define GPT_TIMER2_BASE_ADDRESS           0x40032000
+#define GPT_TIMER3_BASE_ADDRESS           0x40033000
+#define GPT_TIMER4_BASE_ADDRESS           0x40034000
+#define GPT_TIMER5_BASE_ADDRESS           0x40035000
+
+/* 32/64-bit wide GPTM blocks base addresses */
+#define GPT_WIDE_TIMER0_BASE_ADDRESS      0x40036000
+#define GPT_WIDE_TIMER1_BASE_ADDRESS      0x40037000
+#define GPT_WIDE_TIMER2_BASE_ADDRESS      0x4004C000
+#define GPT_WIDE_TIMER3_BASE_ADDRESS      0x4004D000
+#define GPT_WIDE_TIMER4_BASE_ADDRESS      0x4004E000
+#define GPT_WIDE_TIMER5_BASE_ADDRESS      0x4004F000
+
+/* GPTM Registers offset addresses */
+#define GPT_CFG_REG_OFFSET                0x000
+#define GPT_TAMR_REG_OFFSET               0x004
+#define GPT_CTL_REG_OFFSET                0x00C
+#define GPT_IMR_REG_OFFSET                0x018
+#define GPT_RIS_REG_OFFSET                0x01C
+#define GPT_ICR_REG_OFFSET                0x024
+#define GPT_TAILR_REG_OFFSET              0x028
+#define GPT_TBILR_REG_OFFSET              0x02C
+#define GPT_TAMATCHR_REG_OFFSET           0x030
+#define GPT_TBMATCHR_REG_OFFSET           0x034
+#define GPT_TAPR_REG_OFFSET               0x038
+#define GPT_TAR_REG_OFFSET                0x048
+#define GPT_TAV_REG_OFFSET                0x050
+#define GPT_TBV_REG_OFFSET                0x054
+
+/* GPTMCFG: 32-bit timer of a 16/32-bit block or 64-bit timer of a wide block,
+ * 32-bit timer A of a wide block (prescaler available) */
+#define GPT_CFG_CONCATENATED              0x00
+#define GPT_CFG_SPLIT                     0x04
+
+/* GPTMTAMR: TAMR field, the timer counts down (TACDIR = 0) */
+#define GPT_TAMR_ONE_SHOT                 0x01
+#define GPT_TAMR_PERIODIC                 0x02
+
+/* GPTMTAMR: TACDIR, the timer counts up from 0 */
+#define GPT_TAMR_COUNT_UP                 0x10
+
+/* GPTMTAMR: TAMIE, interrupt when the timer reaches the match value */
+#define GPT_TAMR_MATCH_INT                0x20
+
+/* GPTMCTL: TAEN enables timer A, TASTALL freezes it while the debugger halts the CPU */
+#define GPT_CTL_TAEN_MASK                 0x01
+#define GPT_CTL_TASTALL_MASK              0x02
+
+/* GPTMIMR, GPTMRIS and GPTMICR: timer A time-out and timer A match */
+#define GPT_INT_TATO_MASK                 0x01
+#define GPT_INT_TAM_MASK                  0x10
+
+/* NVIC Interrupt Set/Clear Enable registers (32 interrupts each) and byte wide priority registers */
+#define GPT_NVIC_EN_BASE_ADDRESS          0xE000E100
+#define GPT_NVIC_DIS_BASE_ADDRESS         0xE000E180
+#define GPT_NVIC_PRI_BASE_ADDRESS         0xE000E400
+
+/* The priority is held in the 3 upper bits of the priority byte */
+#define GPT_NVIC_PRIORITY_POS             5
+
+#endif /* GPT_REGS_H */
@@ -5,15 +5,523 @@
  * File Name: Mcu.c
  *
  * Description: Source file for TM4C123GH6PM Microcontroller - Mcu Driver
+ *              (system clock tree: oscillators, PLL and system clock divider).
  *
  * Author: Yahia Hamimi
  ******************************************************************************/
 
+#include "Mcu.h"
+#include "Mcu_Regs.h"
 #include "tm4c123gh6pm_registers.h"
 
-void Mcu_Init(void)
+#if (MCU_DEV_ERROR_DETECT == STD_ON)
+
+#include "Det.h"
+/* AUTOSAR Version checking between Det and Mcu Modules */
+#if ((DET_AR_MAJOR_VERSION != MCU_AR_RELEASE_MAJOR_VERSION)\
+ || (DET_AR_MINOR_VERSION != MCU_AR_RELEASE_MINOR_VERSION)\
+ || (DET_AR_PATCH_VERSION != MCU_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Det.h does not match the expected version"
+#endif
+
+#endif
+
+/* Limits of the divider minus 1: 80Mhz is the highest system clock out of the 400Mhz PLL */
+#define MCU_PLL_SYSDIV_MIN          (4U)
+#define MCU_PLL_SYSDIV_MAX          (127U)
+#define MCU_OSC_SYSDIV_MAX          (63U)
+
+/* Highest divider minus 1 of the deep-sleep oscillator */
+#define MCU_DEEP_SLEEP_DIV_MAX      (63U)
+
+/* No clock setting waits for Mcu_DistributePllClock */
+#define MCU_NO_CLOCK_SETTING        (Mcu_ClockType)0xFF
+
+/* Wait For Interrupt ... the CPU sleeps until an interrupt is pending (even if masked by PRIMASK) */
+#define Mcu_Wait_For_Interrupt()    __asm(" WFI ")
+
+STATIC const Mcu_ClockSettingConfigType * Mcu_ClockSettings = NULL_PTR;
+STATIC const Mcu_ModeSettingConfigType * Mcu_ModeSettings = NULL_PTR;
+STATIC uint8 Mcu_Status = MCU_NOT_INITIALIZED;
+
+/* Clock setting applied by Mcu_InitClock whose PLL is not distributed yet */
+STATIC Mcu_ClockType Mcu_PllClockSetting = MCU_NO_CLOCK_SETTING;
+
+/* Current system clock, the PIOSC out of reset */
+STATIC volatile uint32 Mcu_ClockFrequency = MCU_PIOSC_HZ;
+
+/* GPIO ports enabled by Mcu_EnableGpioClocks, they stay clocked in the sleep modes */
+STATIC uint8 Mcu_GpioClocks = 0;
+
+/* Timers and wide timers enabled by Mcu_EnableTimerClocks, they stay clocked in the sleep modes */
+STATIC uint8 Mcu_TimerClocks = 0;
+STATIC uint8 Mcu_WideTimerClocks = 0;
+
+/************************************************************************************
+* Service Name: Mcu_SetSleepClocks
+* Description: Peripherals kept clocked in sleep mode (auto clock gating)
+************************************************************************************/
+STATIC void Mcu_SetSleepClocks(const Mcu_PeripheralClocksType * Clocks)
+{
+    SYSCTL_SCGCGPIO_REG   = Clocks->Gpio | Mcu_GpioClocks;
+    SYSCTL_SCGCTIMER_REG  = Clocks->Timer | Mcu_TimerClocks;
+    SYSCTL_SCGCWTIMER_REG = Clocks->WideTimer | Mcu_WideTimerClocks;
+    SYSCTL_SCGCUART_REG   = Clocks->Uart;
+    SYSCTL_SCGCSSI_REG    = Clocks->Ssi;
+    SYSCTL_SCGCI2C_REG    = Clocks->I2c;
+    SYSCTL_SCGCADC_REG    = Clocks->Adc;
+    SYSCTL_SCGCPWM_REG    = Clocks->Pwm;
+}
+
+/************************************************************************************
+* Service Name: Mcu_SetDeepSleepClocks
+* Description: Peripherals kept clocked in deep-sleep mode (auto clock gating)
+************************************************************************************/
+STATIC void Mcu_SetDeepSleepClocks(const Mcu_PeripheralClocksType * Clocks)
+{
+    SYSCTL_DCGCGPIO_REG   = Clocks->Gpio | Mcu_GpioClocks;
+    SYSCTL_DCGCTIMER_REG  = Clocks->Timer | Mcu_TimerClocks;
+    SYSCTL_DCGCWTIMER_REG = Clocks->WideTimer | Mcu_WideTimerClocks;
+    SYSCTL_DCGCUART_REG   = Clocks->Uart;
+    SYSCTL_DCGCSSI_REG    = Clocks->Ssi;
+    SYSCTL_DCGCI2C_REG    = Clocks->I2c;
+    SYSCTL_DCGCADC_REG    = Clocks->Adc;
+    SYSCTL_DCGCPWM_REG    = Clocks->Pwm;
+}
+
+/************************************************************************************
+* Service Name: Mcu_Init
+* Service ID[hex]: 0x00
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): ConfigPtr - Pointer to post-build configuration data
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to Initialize the Mcu module, the system clock keeps running from the
+*              PIOSC until Mcu_InitClock. The peripheral clocks are enabled by the drivers
+*              (Port and Dio through Mcu_EnableGpioClocks, Gpt through Mcu_EnableTimerClocks)
+*              for the peripherals of their configuration only.
+************************************************************************************/
+void Mcu_Init(const Mcu_ConfigType * ConfigPtr)
+{
+    boolean error = FALSE;
+#if (MCU_DEV_ERROR_DETECT == STD_ON)
+    Mcu_ClockType clock;
+    Mcu_ModeType mode;
+    const Mcu_ClockSettingConfigType * setting;
+    const Mcu_ModeSettingConfigType * mode_setting;
+#endif
+
+#if (MCU_DEV_ERROR_DETECT == STD_ON)
+    /* check if the input configuration pointer is not a NULL_PTR */
+    if (NULL_PTR == ConfigPtr)
+    {
+        Det_ReportError(MCU_MODULE_ID, MCU_INSTANCE_ID, MCU_INIT_SID, MCU_E_PARAM_CONFIG);
+        error = TRUE;
+    }
+    else
+    {
+        /* Only the 16Mhz crystal is supported, the PLL output is divided by 5 at least and the
+         * oscillator divider has 6 bits */
+        for(clock = 0; clock < MCU_CONFIGURED_CLOCK_SETTINGS; clock++)
+        {
+            setting = &ConfigPtr->ClockSettings[clock];
+            if((setting->Source > MCU_CLOCK_SOURCE_PIOSC) || (setting->Crystal != MCU_XTAL_16MHZ) || (0U == setting->Frequency)
+               || ((TRUE == setting->Pll) && ((setting->SysDiv < MCU_PLL_SYSDIV_MIN) || (setting->SysDiv > MCU_PLL_SYSDIV_MAX)))
+               || ((FALSE == setting->Pll) && (setting->SysDiv > MCU_OSC_SYSDIV_MAX)))
+            {
+                Det_ReportError(MCU_MODULE_ID, MCU_INSTANCE_ID, MCU_INIT_SID, MCU_E_PARAM_CONFIG);
+                error = TRUE;
+                break;
+            }
+        }
+
+        /* The deep-sleep oscillator is the main oscillator, the PIOSC or the LFIOSC */
+        for(mode = 0; (FALSE == error) && (mode < MCU_CONFIGURED_MODES); mode++)
+        {
+            mode_setting = &ConfigPtr->ModeSettings[mode];
+            if((mode_setting->PowerMode > MCU_POWER_DEEP_SLEEP) || (mode_setting->DeepSleepDiv > MCU_DEEP_SLEEP_DIV_MAX)
+               || ((mode_setting->DeepSleepSource != MCU_CLOCK_SOURCE_MAIN_OSC) && (mode_setting->DeepSleepSource != MCU_CLOCK_SOURCE_PIOSC)
+                   && (mode_setting->DeepSleepSource != MCU_CLOCK_SOURCE_LFIOSC)))
+            {
+                Det_ReportError(MCU_MODULE_ID, MCU_INSTANCE_ID, MCU_INIT_SID, MCU_E_PARAM_CONFIG);
+                error = TRUE;
+            }
+        }
+    }
+#endif
+
+    /* In-case there are no errors */
+    if(FALSE == error)
+    {
+        Mcu_ClockSettings = ConfigPtr->ClockSettings; /* address of the first clock setting --> ClockSettings[0] */
+        Mcu_ModeSettings  = ConfigPtr->ModeSettings;  /* address of the first mode --> ModeSettings[0] */
+
+        Mcu_Status = MCU_INITIALIZED;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+
+/************************************************************************************
+* Service Name: Mcu_InitClock
+* Service ID[hex]: 0x02
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): ClockSetting - Index of the clock setting
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_OK: the clock setting is applied or its PLL is locking
+*                                E_NOT_OK: invalid clock setting or the main oscillator did not
+*                                          start, the system clock is left unchanged
+* Description: Function to apply a clock setting. Without the PLL the system clock is switched
+*              at once, with the PLL the system clock runs from the bypassed oscillator until
+*              Mcu_DistributePllClock once Mcu_GetPllStatus reports the PLL locked. A setting
+*              of the PIOSC powers the main oscillator down.
+************************************************************************************/
+Std_ReturnType Mcu_InitClock(Mcu_ClockType ClockSetting)
+{
+    const Mcu_ClockSettingConfigType * setting;
+    uint32 rcc2;
+    uint32 retries;
+    boolean error = FALSE;
+
+#if (MCU_DEV_ERROR_DETECT == STD_ON)
+    /* Check if the Driver is initialized before using this function */
+    if (MCU_NOT_INITIALIZED == Mcu_Status)
+    {
+        Det_ReportError(MCU_MODULE_ID, MCU_INSTANCE_ID, MCU_INIT_CLOCK_SID, MCU_E_UNINIT);
+        error = TRUE;
+    }
+    else if (ClockSetting >= MCU_CONFIGURED_CLOCK_SETTINGS)
+    {
+        Det_ReportError(MCU_MODULE_ID, MCU_INSTANCE_ID, MCU_INIT_CLOCK_SID, MCU_E_PARAM_CLOCK);
+        error = TRUE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+#endif
+
+    /* Start the main oscillator and wait until it is stable, a missing crystal leaves the
+     * system clock untouched */
+    if((FALSE == error) && (MCU_CLOCK_SOURCE_MAIN_OSC == Mcu_ClockSettings[ClockSetting].Source))
+    {
+        SYSCTL_RCC_REG &= ~MCU_RCC_MOSCDIS_MASK;
+        for(retries = 0; !(SYSCTL_RIS_REG & MCU_RIS_MOSCPUPRIS_MASK) && (retries < MCU_OSC_STARTUP_RETRIES); retries++);
+        if(!(SYSCTL_RIS_REG & MCU_RIS_MOSCPUPRIS_MASK))
+        {
+            SYSCTL_RCC_REG |= MCU_RCC_MOSCDIS_MASK;
+            error = TRUE;
+        }
+    }
+
+    /* In-case there are no errors */
+    if(FALSE == error)
+    {
+        setting = &Mcu_ClockSettings[ClockSetting];
+
+        /* RCC2 takes over the RCC fields, the system clock runs from the undivided oscillator
+         * while the oscillator, the PLL and the divider are changed */
+        SYSCTL_RCC2_REG |= MCU_RCC2_USERCC2_MASK | MCU_RCC2_BYPASS2_MASK;
+        SYSCTL_RCC_REG  &= ~MCU_RCC_USESYSDIV_MASK;
+        SYSCTL_RCC_REG = (SYSCTL_RCC_REG & ~MCU_RCC_XTAL_MASK) | ((uint32)setting->Crystal << MCU_RCC_XTAL_POS);
+
+        rcc2 = SYSCTL_RCC2_REG & ~(MCU_RCC2_OSCSRC2_MASK | MCU_RCC2_SYSDIV_MASK | MCU_RCC2_DIV400_MASK | MCU_RCC2_PWRDN2_MASK);
+        rcc2 |= (uint32)setting->Source << MCU_RCC2_OSCSRC2_POS;
+
+        if(TRUE == setting->Pll)
+        {
+            /* Power the PLL with the 400Mhz output divider, it stays bypassed until it locks and
+             * the system clock runs from the undivided oscillator meanwhile */
+            SYSCTL_RCC2_REG = rcc2 | MCU_RCC2_DIV400_MASK | ((uint32)setting->SysDiv << MCU_RCC2_SYSDIV2LSB_POS);
+            Mcu_PllClockSetting = ClockSetting;
+            Mcu_ClockFrequency  = (MCU_CLOCK_SOURCE_PIOSC == setting->Source) ? MCU_PIOSC_HZ : MCU_XTAL_16MHZ_HZ;
+        }
+        else
+        {
+            /* Power down the PLL and divide the oscillator */
+            SYSCTL_RCC2_REG = rcc2 | MCU_RCC2_PWRDN2_MASK | ((uint32)setting->SysDiv << MCU_RCC2_SYSDIV2_POS);
+            if(setting->SysDiv != 0U)
+            {
+                SYSCTL_RCC_REG |= MCU_RCC_USESYSDIV_MASK;
+            }
+            Mcu_PllClockSetting = MCU_NO_CLOCK_SETTING;
+            Mcu_ClockFrequency  = setting->Frequency;
+        }
+
+        /* The main oscillator is powered down once the system clock no longer runs from it,
+         * as after a failed PLL lock falling back to the PIOSC */
+        if(MCU_CLOCK_SOURCE_PIOSC == setting->Source)
+        {
+            SYSCTL_RCC_REG |= MCU_RCC_MOSCDIS_MASK;
+        }
+        return E_OK;
+    }
+    else
+    {
+        return E_NOT_OK;
+    }
+}
+
+/************************************************************************************
+* Service Name: Mcu_DistributePllClock
+* Service ID[hex]: 0x03
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to switch the system clock to the locked PLL in one register write.
+************************************************************************************/
+void Mcu_DistributePllClock(void)
+{
+    boolean error = FALSE;
+
+#if (MCU_DEV_ERROR_DETECT == STD_ON)
+    /* Check if the Driver is initialized before using this function */
+    if (MCU_NOT_INITIALIZED == Mcu_Status)
+    {
+        Det_ReportError(MCU_MODULE_ID, MCU_INSTANCE_ID, MCU_DISTRIBUTE_PLL_CLOCK_SID, MCU_E_UNINIT);
+        error = TRUE;
+    }
+    else if ((MCU_NO_CLOCK_SETTING == Mcu_PllClockSetting) || !(SYSCTL_PLLSTAT_REG & MCU_PLLSTAT_LOCK_MASK))
+    {
+        Det_ReportError(MCU_MODULE_ID, MCU_INSTANCE_ID, MCU_DISTRIBUTE_PLL_CLOCK_SID, MCU_E_PLL_NOT_LOCKED);
+        error = TRUE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+#endif
+
+    /* In-case there are no errors */
+    if((FALSE == error) && (Mcu_PllClockSetting != MCU_NO_CLOCK_SETTING))
+    {
+        /* Clearing BYPASS2 moves the system clock to the divided PLL output at once */
+        SYSCTL_RCC2_REG &= ~MCU_RCC2_BYPASS2_MASK;
+        Mcu_ClockFrequency  = Mcu_ClockSettings[Mcu_PllClockSetting].Frequency;
+        Mcu_PllClockSetting = MCU_NO_CLOCK_SETTING;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+
+/************************************************************************************
+* Service Name: Mcu_GetPllStatus
+* Service ID[hex]: 0x04
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Mcu_PllStatusType - MCU_PLL_LOCKED, MCU_PLL_UNLOCKED (or powered down)
+*                                   or MCU_PLL_STATUS_UNDEFINED before Mcu_Init
+* Description: Function to read the lock status of the PLL.
+************************************************************************************/
+Mcu_PllStatusType Mcu_GetPllStatus(void)
+{
+    if (MCU_NOT_INITIALIZED == Mcu_Status)
+    {
+#if (MCU_DEV_ERROR_DETECT == STD_ON)
+        Det_ReportError(MCU_MODULE_ID, MCU_INSTANCE_ID, MCU_GET_PLL_STATUS_SID, MCU_E_UNINIT);
+#endif
+        return MCU_PLL_STATUS_UNDEFINED;
+    }
+    return (SYSCTL_PLLSTAT_REG & MCU_PLLSTAT_LOCK_MASK) ? MCU_PLL_LOCKED : MCU_PLL_UNLOCKED;
+}
+
+/************************************************************************************
+* Service Name: Mcu_SetMode
+* Service ID[hex]: 0x08
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): McuMode - Index of the mode
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to sleep in a sleep or deep-sleep mode until one of its wake-up
+*              interrupts: only the configured peripherals stay clocked, the other
+*              interrupts stay pending. The clocks, the PLL and the interrupts are restored
+*              before it returns, only the interrupts this function disabled are enabled
+*              again so the changes made by a waking interrupt served at once are kept.
+*              Called with the interrupts disabled (PRIMASK) the waking interrupt is served
+*              once the caller enables them again.
+************************************************************************************/
+void Mcu_SetMode(Mcu_ModeType McuMode)
+{
+    const Mcu_ModeSettingConfigType * setting;
+    uint32 disabled_irqs[MCU_NVIC_REGS];
+    uint32 retries;
+    uint8 reg;
+    boolean error = FALSE;
+
+#if (MCU_DEV_ERROR_DETECT == STD_ON)
+    /* Check if the Driver is initialized before using this function */
+    if (MCU_NOT_INITIALIZED == Mcu_Status)
+    {
+        Det_ReportError(MCU_MODULE_ID, MCU_INSTANCE_ID, MCU_SET_MODE_SID, MCU_E_UNINIT);
+        error = TRUE;
+    }
+    else if (McuMode >= MCU_CONFIGURED_MODES)
+    {
+        Det_ReportError(MCU_MODULE_ID, MCU_INSTANCE_ID, MCU_SET_MODE_SID, MCU_E_PARAM_MODE);
+        error = TRUE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+#endif
+
+    /* In-case there are no errors and the CPU has to sleep */
+    if((FALSE == error) && (Mcu_ModeSettings[McuMode].PowerMode != MCU_POWER_RUN))
+    {
+        setting = &Mcu_ModeSettings[McuMode];
+
+        /* Only the wake-up interrupts stay enabled, the others are still latched as pending */
+        for(reg = 0; reg < MCU_NVIC_REGS; reg++)
+        {
+            disabled_irqs[reg] = *((volatile uint32 *)MCU_NVIC_EN_BASE_ADDRESS + reg) & ~setting->WakeupIrqs[reg];
+            *((volatile uint32 *)MCU_NVIC_DIS_BASE_ADDRESS + reg) = disabled_irqs[reg];
+        }
+
+        if(MCU_POWER_SLEEP == setting->PowerMode)
+        {
+            Mcu_SetSleepClocks(&setting->Clocks);
+        }
+        else
+        {
+            Mcu_SetDeepSleepClocks(&setting->Clocks);
+            SYSCTL_DSLPCLKCFG_REG = ((uint32)setting->DeepSleepSource << MCU_DSLPCLKCFG_DSOSCSRC_POS)
+                                  | ((uint32)setting->DeepSleepDiv << MCU_DSLPCLKCFG_DSDIVORIDE_POS);
+            MCU_SCR_REG |= MCU_SCR_SLEEPDEEP_MASK;
+        }
+
+        /* The SCGC/DCGC registers only gate the clocks while the CPU sleeps in this call */
+        SYSCTL_RCC_REG |= MCU_RCC_ACG_MASK;
+        Mcu_Wait_For_Interrupt();
+        SYSCTL_RCC_REG &= ~MCU_RCC_ACG_MASK;
+        MCU_SCR_REG    &= ~MCU_SCR_SLEEPDEEP_MASK;
+
+        /* The hardware restarts the PLL powered down in deep-sleep, it is used again once locked */
+        if((SYSCTL_RCC2_REG & MCU_RCC2_USERCC2_MASK) && !(SYSCTL_RCC2_REG & (MCU_RCC2_BYPASS2_MASK | MCU_RCC2_PWRDN2_MASK)))
+        {
+            for(retries = 0; !(SYSCTL_PLLSTAT_REG & MCU_PLLSTAT_LOCK_MASK) && (retries < MCU_PLL_LOCK_RETRIES); retries++);
+        }
+
+        for(reg = 0; reg < MCU_NVIC_REGS; reg++)
+        {
+            *((volatile uint32 *)MCU_NVIC_EN_BASE_ADDRESS + reg) = disabled_irqs[reg];
+        }
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+
+/************************************************************************************
+* Service Name: Mcu_GetClockFrequency
+* Service ID[hex]: 0x10
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - System clock in Hz
+* Description: Function to read the current system clock, the drivers compute their dividers
+*              from it (the PIOSC frequency out of reset, the bypassed oscillator frequency
+*              while the PLL locks).
+************************************************************************************/
+uint32 Mcu_GetClockFrequency(void)
+{
+    return Mcu_ClockFrequency;
+}
+
+/************************************************************************************
+* Service Name: Mcu_EnableGpioClocks
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): PortsMask - GPIO ports to clock (bit n = port n, A to F)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to enable the run mode clock of GPIO ports and wait until all of them
+*              are ready, the ports already clocked are kept. The ports stay clocked in the
+*              sleep and deep-sleep modes of Mcu_SetMode. It can be called before Mcu_Init.
+************************************************************************************/
+void Mcu_EnableGpioClocks(uint8 PortsMask)
+{
+    Mcu_GpioClocks |= PortsMask;
+    SYSCTL_RCGCGPIO_REG |= PortsMask;
+    while((SYSCTL_PRGPIO_REG & PortsMask) != PortsMask);
+}
+
+/************************************************************************************
+* Service Name: Mcu_EnableTimerClocks
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): TimersMask - 16/32-bit timers to clock (bit n = timer n, 0 to 5)
+*                  WideTimersMask - 32/64-bit wide timers to clock (bit n = wide timer n, 0 to 5)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to enable the run mode clock of GPTM blocks and wait until all of them
+*              are ready, the blocks already clocked are kept. The blocks stay clocked in the
+*              sleep and deep-sleep modes of Mcu_SetMode. It can be called before Mcu_Init.
+************************************************************************************/
+void Mcu_EnableTimerClocks(uint8 TimersMask, uint8 WideTimersMask)
+{
+    Mcu_TimerClocks     |= TimersMask;
+    Mcu_WideTimerClocks |= WideTimersMask;
+    SYSCTL_RCGCTIMER_REG  |= TimersMask;
+    SYSCTL_RCGCWTIMER_REG |= WideTimersMask;
+    while(((SYSCTL_PRTIMER_REG & TimersMask) != TimersMask) || ((SYSCTL_PRWTIMER_REG & WideTimersMask) != WideTimersMask));
+}
+
+/************************************************************************************
+* Service Name: Mcu_GetVersionInfo
+* Service ID[hex]: 0x09
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): VersionInfo - Pointer to where to store the version information of this module.
+* Return value: None
+* Description: Function to get the version information of this module.
+************************************************************************************/
+#if (MCU_VERSION_INFO_API == STD_ON)
+void Mcu_GetVersionInfo(Std_VersionInfoType * VersionInfo)
 {
-    /* Enable clock for All PORTs and wait for clock to start */
-    SYSCTL_RCGCGPIO_REG |= 0x3F;
-    while(!(SYSCTL_PRGPIO_REG & 0x3F));
+#if (MCU_DEV_ERROR_DETECT == STD_ON)
+    /* Check if input pointer is not Null pointer */
+    if(NULL_PTR == VersionInfo)
+    {
+        /* Report to DET  */
+        Det_ReportError(MCU_MODULE_ID, MCU_INSTANCE_ID, MCU_GET_VERSION_INFO_SID, MCU_E_PARAM_POINTER);
+    }
+    else
+#endif /* (MCU_DEV_ERROR_DETECT == STD_ON) */
+    {
+        /* Copy the vendor Id */
+        VersionInfo->vendorID = (uint16)MCU_VENDOR_ID;
+        /* Copy the module Id */
+        VersionInfo->moduleID = (uint16)MCU_MODULE_ID;
+        /* Copy Software Major Version */
+        VersionInfo->sw_major_version = (uint8)MCU_SW_MAJOR_VERSION;
+        /* Copy Software Minor Version */
+        VersionInfo->sw_minor_version = (uint8)MCU_SW_MINOR_VERSION;
+        /* Copy Software Patch Version */
+        VersionInfo->sw_patch_version = (uint8)MCU_SW_PATCH_VERSION;
+    }
 }
+#endif
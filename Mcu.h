@@ -5,6 +5,7 @@
  * File Name: Mcu.h
  *
  * Description: Header file for TM4C123GH6PM Microcontroller - Mcu Driver
+ *              (system clock tree: oscillators, PLL and system clock divider).
  *
  * Author: Yahia Hamimi
  ******************************************************************************/
@@ -13,8 +14,361 @@
 #ifndef MCU_H_
 #define MCU_H_
 
+/* Id for the company in the AUTOSAR
+ * for example yahia's ID = 1000 :) */
+#define MCU_VENDOR_ID    (1000U)
+
+/* Mcu Module Id */
+#define MCU_MODULE_ID    (101U)
+
+/* Mcu Instance Id */
+#define MCU_INSTANCE_ID  (0U)
+
+/*
+ * Module Version 1.0.0
+ */
+#define MCU_SW_MAJOR_VERSION           (1U)
+#define MCU_SW_MINOR_VERSION           (0U)
+#define MCU_SW_PATCH_VERSION           (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define MCU_AR_RELEASE_MAJOR_VERSION   (4U)
+#define MCU_AR_RELEASE_MINOR_VERSION   (0U)
+#define MCU_AR_RELEASE_PATCH_VERSION   (3U)
+
+/*
+ * Macros for Mcu Status
+ */
+#define MCU_INITIALIZED                (1U)
+#define MCU_NOT_INITIALIZED            (0U)
+
+/* Standard AUTOSAR types */
 #include "Std_Types.h"
 
-void Mcu_Init(void);
+/* AUTOSAR checking between Std Types and Mcu Modules */
+#if ((STD_TYPES_AR_RELEASE_MAJOR_VERSION != MCU_AR_RELEASE_MAJOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_MINOR_VERSION != MCU_AR_RELEASE_MINOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_PATCH_VERSION != MCU_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Std_Types.h does not match the expected version"
+#endif
+
+/* Mcu Pre-Compile Configuration Header file */
+#include "Mcu_Cfg.h"
+
+/* AUTOSAR Version checking between Mcu_Cfg.h and Mcu.h files */
+#if ((MCU_CFG_AR_RELEASE_MAJOR_VERSION != MCU_AR_RELEASE_MAJOR_VERSION)\
+ ||  (MCU_CFG_AR_RELEASE_MINOR_VERSION != MCU_AR_RELEASE_MINOR_VERSION)\
+ ||  (MCU_CFG_AR_RELEASE_PATCH_VERSION != MCU_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Mcu_Cfg.h does not match the expected version"
+#endif
+
+/* Software Version checking between Mcu_Cfg.h and Mcu.h files */
+#if ((MCU_CFG_SW_MAJOR_VERSION != MCU_SW_MAJOR_VERSION)\
+ ||  (MCU_CFG_SW_MINOR_VERSION != MCU_SW_MINOR_VERSION)\
+ ||  (MCU_CFG_SW_PATCH_VERSION != MCU_SW_PATCH_VERSION))
+  #error "The SW version of Mcu_Cfg.h does not match the expected version"
+#endif
+
+#if ((MCU_CONFIGURED_CLOCK_SETTINGS == 0U) || (MCU_CONFIGURED_MODES == 0U))
+  #error "At least one clock setting and one mode must be configured"
+#endif
+
+/******************************************************************************
+ *                      API Service Id Macros                                 *
+ ******************************************************************************/
+/* Service ID for Mcu Init */
+#define MCU_INIT_SID                   (uint8)0x00
+
+/* Service ID for Mcu InitClock */
+#define MCU_INIT_CLOCK_SID             (uint8)0x02
+
+/* Service ID for Mcu DistributePllClock */
+#define MCU_DISTRIBUTE_PLL_CLOCK_SID   (uint8)0x03
+
+/* Service ID for Mcu GetPllStatus */
+#define MCU_GET_PLL_STATUS_SID         (uint8)0x04
+
+/* Service ID for Mcu SetMode */
+#define MCU_SET_MODE_SID               (uint8)0x08
+
+/* Service ID for Mcu GetVersionInfo */
+#define MCU_GET_VERSION_INFO_SID       (uint8)0x09
+
+/* Service ID for Mcu GetClockFrequency */
+#define MCU_GET_CLOCK_FREQUENCY_SID    (uint8)0x10
+
+/*******************************************************************************
+ *                      DET Error Codes                                        *
+ *******************************************************************************/
+/* Mcu_Init called with a NULL pointer or an invalid clock setting */
+#define MCU_E_PARAM_CONFIG             (uint8)0x0A
+
+/* DET code to report an invalid clock setting */
+#define MCU_E_PARAM_CLOCK              (uint8)0x0B
+
+/* DET code to report an invalid mode */
+#define MCU_E_PARAM_MODE               (uint8)0x0C
+
+/* Mcu_DistributePllClock called before the PLL locked */
+#define MCU_E_PLL_NOT_LOCKED           (uint8)0x0E
+
+/* API service used without module initialization */
+#define MCU_E_UNINIT                   (uint8)0x0F
+
+/* DET code to report a NULL pointer parameter */
+#define MCU_E_PARAM_POINTER            (uint8)0x10
+
+/*******************************************************************************
+ *                      Clock Sources                                          *
+ *******************************************************************************/
+/* OSCSRC2 value of the oscillator feeding the PLL or the system clock divider */
+#define MCU_CLOCK_SOURCE_MAIN_OSC      (Mcu_ClockSourceType)0
+#define MCU_CLOCK_SOURCE_PIOSC         (Mcu_ClockSourceType)1
+
+/* DSOSCSRC value of the 30Khz internal oscillator, deep-sleep only */
+#define MCU_CLOCK_SOURCE_LFIOSC        (Mcu_ClockSourceType)3
+
+/* XTAL value of a 16Mhz crystal, it must also be set when the PLL runs from the PIOSC */
+#define MCU_XTAL_16MHZ                 (uint8)0x15
+
+/* Frequency of the main oscillator with the MCU_XTAL_16MHZ crystal */
+#define MCU_XTAL_16MHZ_HZ              (16000000UL)
+
+/* Frequency of the PIOSC running the system clock out of reset */
+#define MCU_PIOSC_HZ                   (16000000UL)
+
+/* NVIC Interrupt Enable registers covering the 139 interrupts */
+#define MCU_NVIC_REGS                  (5U)
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Type definition for Mcu_ClockType used by Mcu_InitClock (index of a clock setting) */
+typedef uint8 Mcu_ClockType;
+
+/* Type definition for Mcu_ClockSourceType used by the clock settings (MCU_CLOCK_SOURCE_xxx) */
+typedef uint8 Mcu_ClockSourceType;
+
+/* Type definition for Mcu_ModeType used by Mcu_SetMode (index of a mode) */
+typedef uint8 Mcu_ModeType;
+
+/* Type definition for Mcu_PowerModeType used by the modes */
+typedef enum
+{
+    MCU_POWER_RUN,          /* The CPU keeps running, Mcu_SetMode returns at once */
+    MCU_POWER_SLEEP,        /* The CPU clock stops, the system clock keeps running */
+    MCU_POWER_DEEP_SLEEP    /* The system clock moves to the deep-sleep oscillator, the PLL stops */
+} Mcu_PowerModeType;
+
+/* Type definition for Mcu_PllStatusType returned by Mcu_GetPllStatus */
+typedef enum
+{
+    MCU_PLL_LOCKED,
+    MCU_PLL_UNLOCKED,
+    MCU_PLL_STATUS_UNDEFINED
+} Mcu_PllStatusType;
+
+/* Description: Structure to configure each clock setting:
+ *  1. The oscillator: main oscillator (crystal) or PIOSC
+ *  2. The XTAL value of the crystal
+ *  3. The PLL is used or bypassed
+ *  4. The divider minus 1: of the 400Mhz PLL output (4 to 127) or of the oscillator (0 to 63)
+ *  5. The resulting system clock in Hz
+ */
+typedef struct
+{
+    Mcu_ClockSourceType Source;
+    uint8 Crystal;
+    boolean Pll;
+    uint8 SysDiv;
+    uint32 Frequency;
+} Mcu_ClockSettingConfigType;
+
+/* Description: Modules of each peripheral kept clocked (bit n = module n) */
+typedef struct
+{
+    uint8 Gpio;         /* GPIO ports A to F, besides the ones of Mcu_EnableGpioClocks */
+    uint8 Timer;        /* 16/32-bit timers 0 to 5, besides the ones of Mcu_EnableTimerClocks */
+    uint8 WideTimer;    /* 32/64-bit wide timers 0 to 5, besides the ones of Mcu_EnableTimerClocks */
+    uint8 Uart;         /* UARTs 0 to 7 */
+    uint8 Ssi;          /* SSIs 0 to 3 */
+    uint8 I2c;          /* I2Cs 0 to 3 */
+    uint8 Adc;          /* ADCs 0 and 1 */
+    uint8 Pwm;          /* PWMs 0 and 1 */
+} Mcu_PeripheralClocksType;
+
+/* Description: Structure to configure each mode:
+ *  1. The power mode: run, sleep or deep-sleep
+ *  2. The peripherals kept clocked while the CPU sleeps (SCGC or DCGC registers)
+ *  3. The NVIC interrupts left enabled to wake the CPU (bit n of word n / 32 = interrupt n),
+ *     the SysTick exception always wakes it
+ *  4. The deep-sleep oscillator (MCU_CLOCK_SOURCE_MAIN_OSC, _PIOSC or _LFIOSC) and its divider minus 1,
+ *     the main oscillator only runs while a clock setting of the main oscillator is applied
+ */
+typedef struct
+{
+    Mcu_PowerModeType PowerMode;
+    Mcu_PeripheralClocksType Clocks;
+    uint32 WakeupIrqs[MCU_NVIC_REGS];
+    Mcu_ClockSourceType DeepSleepSource;
+    uint8 DeepSleepDiv;
+} Mcu_ModeSettingConfigType;
+
+/* Data Structure required for initializing the Mcu Driver */
+typedef struct Mcu_ConfigType
+{
+    Mcu_ClockSettingConfigType ClockSettings[MCU_CONFIGURED_CLOCK_SETTINGS];
+    Mcu_ModeSettingConfigType ModeSettings[MCU_CONFIGURED_MODES];
+} Mcu_ConfigType;
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/************************************************************************************
+* Service Name: Mcu_Init
+* Service ID[hex]: 0x00
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): ConfigPtr - Pointer to post-build configuration data
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to Initialize the Mcu module, the system clock keeps running from the
+*              PIOSC until Mcu_InitClock.
+************************************************************************************/
+void Mcu_Init(const Mcu_ConfigType * ConfigPtr);
+
+/************************************************************************************
+* Service Name: Mcu_InitClock
+* Service ID[hex]: 0x02
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): ClockSetting - Index of the clock setting
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_OK: the clock setting is applied or its PLL is locking
+*                                E_NOT_OK: invalid clock setting
+* Description: Function to apply a clock setting. Without the PLL the system clock is switched
+*              at once, with the PLL the system clock runs from the bypassed oscillator until
+*              Mcu_DistributePllClock once Mcu_GetPllStatus reports the PLL locked. A setting
+*              of the PIOSC powers the main oscillator down.
+************************************************************************************/
+Std_ReturnType Mcu_InitClock(Mcu_ClockType ClockSetting);
+
+/************************************************************************************
+* Service Name: Mcu_DistributePllClock
+* Service ID[hex]: 0x03
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to switch the system clock to the locked PLL in one register write.
+************************************************************************************/
+void Mcu_DistributePllClock(void);
+
+/************************************************************************************
+* Service Name: Mcu_GetPllStatus
+* Service ID[hex]: 0x04
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Mcu_PllStatusType - MCU_PLL_LOCKED, MCU_PLL_UNLOCKED (or powered down)
+*                                   or MCU_PLL_STATUS_UNDEFINED before Mcu_Init
+* Description: Function to read the lock status of the PLL.
+************************************************************************************/
+Mcu_PllStatusType Mcu_GetPllStatus(void);
+
+/************************************************************************************
+* Service Name: Mcu_SetMode
+* Service ID[hex]: 0x08
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): McuMode - Index of the mode
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to sleep in a sleep or deep-sleep mode until one of its wake-up
+*              interrupts: only the configured peripherals stay clocked, the other
+*              interrupts stay pending. The clocks, the PLL and the interrupts are restored
+*              before it returns, only the interrupts this function disabled are enabled
+*              again so the changes made by a waking interrupt served at once are kept.
+*              Called with the interrupts disabled (PRIMASK) the waking interrupt is served
+*              once the caller enables them again.
+************************************************************************************/
+void Mcu_SetMode(Mcu_ModeType McuMode);
+
+/************************************************************************************
+* Service Name: Mcu_GetClockFrequency
+* Service ID[hex]: 0x10
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - System clock in Hz
+* Description: Function to read the current system clock, the drivers compute their dividers
+*              from it (the PIOSC frequency out of reset, the bypassed oscillator frequency
+*              while the PLL locks).
+************************************************************************************/
+uint32 Mcu_GetClockFrequency(void);
+
+/************************************************************************************
+* Service Name: Mcu_EnableGpioClocks
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): PortsMask - GPIO ports to clock (bit n = port n, A to F)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to enable the run mode clock of GPIO ports and wait until all of them
+*              are ready, used by Port and Dio for the ports of their configuration. The ports
+*              stay clocked in the sleep and deep-sleep modes of Mcu_SetMode.
+************************************************************************************/
+void Mcu_EnableGpioClocks(uint8 PortsMask);
+
+/************************************************************************************
+* Service Name: Mcu_EnableTimerClocks
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): TimersMask - 16/32-bit timers to clock (bit n = timer n, 0 to 5)
+*                  WideTimersMask - 32/64-bit wide timers to clock (bit n = wide timer n, 0 to 5)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to enable the run mode clock of GPTM blocks and wait until all of them
+*              are ready, used by Gpt for its channels and its timestamp. The blocks stay
+*              clocked in the sleep and deep-sleep modes of Mcu_SetMode.
+************************************************************************************/
+void Mcu_EnableTimerClocks(uint8 TimersMask, uint8 WideTimersMask);
+
+/************************************************************************************
+* Service Name: Mcu_GetVersionInfo
+* Service ID[hex]: 0x09
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): VersionInfo - Pointer to where to store the version information of this module.
+* Return value: None
+* Description: Function to get the version information of this module.
+************************************************************************************/
+#if (MCU_VERSION_INFO_API == STD_ON)
+void Mcu_GetVersionInfo(Std_VersionInfoType * VersionInfo);
+#endif
+
+/*******************************************************************************
+ *                       External Variables                                    *
+ *******************************************************************************/
+
+/* Extern PB structures to be used by Mcu */
+extern const Mcu_ConfigType Mcu_Configuration;
 
 #endif /* MCU_H_ */
@@ -0,0 +1,61 @@
+ /******************************************************************************
+ *
+ * Module: Mcu
+ *
+ * File Name: Mcu_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for TM4C123GH6PM Microcontroller - Mcu Driver
+ *
+ * Author: Yahia Hamimi
+ ******************************************************************************/
+
+#ifndef MCU_CFG_H
+#define MCU_CFG_H
+
+/*
+ * Module Version 1.0.0
+ */
+#define MCU_CFG_SW_MAJOR_VERSION              (1U)
+#define MCU_CFG_SW_MINOR_VERSION              (0U)
+#define MCU_CFG_SW_PATCH_VERSION              (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define MCU_CFG_AR_RELEASE_MAJOR_VERSION     (4U)
+#define MCU_CFG_AR_RELEASE_MINOR_VERSION     (0U)
+#define MCU_CFG_AR_RELEASE_PATCH_VERSION     (3U)
+
+/* Pre-compile option for Development Error Detect */
+#define MCU_DEV_ERROR_DETECT                 (STD_ON)
+
+/* Pre-compile option for Version Info API */
+#define MCU_VERSION_INFO_API                 (STD_OFF)
+
+/* Number of the configured clock settings */
+#define MCU_CONFIGURED_CLOCK_SETTINGS        (2U)
+
+/* Clock setting Index in the array of structures in Mcu_PBcfg.c */
+#define McuConf_PIOSC_16MHZ_CLOCK_ID         (Mcu_ClockType)0x00
+#define McuConf_PLL_80MHZ_CLOCK_ID           (Mcu_ClockType)0x01
+
+/* Number of the configured modes */
+#define MCU_CONFIGURED_MODES                 (3U)
+
+/* Mode Index in the array of structures in Mcu_PBcfg.c */
+#define McuConf_RUN_MODE_ID                  (Mcu_ModeType)0x00
+#define McuConf_SLEEP_MODE_ID                (Mcu_ModeType)0x01
+#define McuConf_DEEP_SLEEP_MODE_ID           (Mcu_ModeType)0x02
+
+/* Polls of the main oscillator power-up flag in Mcu_InitClock before the oscillator is
+ * reported missing, and of the PLL lock by Init Task before it falls back to the PIOSC
+ * (about 10 ms at the 16Mhz PIOSC each) */
+#define MCU_OSC_STARTUP_RETRIES              (20000UL)
+#define MCU_PLL_LOCK_RETRIES                 (20000UL)
+
+/* System clock in Hz once Init Task distributed McuConf_PLL_80MHZ_CLOCK_ID, the configurations
+ * written for a fixed clock (Gpt prescalers) take it from here and the drivers scale them to
+ * Mcu_GetClockFrequency at run time */
+#define MCU_SYSTEM_CLOCK_HZ                  (80000000UL)
+
+#endif /* MCU_CFG_H */
@@ -0,0 +1,74 @@
+ /******************************************************************************
+ *
+ * Module: Mcu
+ *
+ * File Name: Mcu_PBcfg.c
+ *
+ * Description: Post Build Configuration Source file for TM4C123GH6PM Microcontroller - Mcu Driver
+ *
+ * Author: Yahia Hamimi
+ ******************************************************************************/
+
+#include "Mcu.h"
+
+/*
+ * Module Version 1.0.0
+ */
+#define MCU_PBCFG_SW_MAJOR_VERSION              (1U)
+#define MCU_PBCFG_SW_MINOR_VERSION              (0U)
+#define MCU_PBCFG_SW_PATCH_VERSION              (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define MCU_PBCFG_AR_RELEASE_MAJOR_VERSION     (4U)
+#define MCU_PBCFG_AR_RELEASE_MINOR_VERSION     (0U)
+#define MCU_PBCFG_AR_RELEASE_PATCH_VERSION     (3U)
+
+/* AUTOSAR Version checking between Mcu_PBcfg.c and Mcu.h files */
+#if ((MCU_PBCFG_AR_RELEASE_MAJOR_VERSION != MCU_AR_RELEASE_MAJOR_VERSION)\
+ ||  (MCU_PBCFG_AR_RELEASE_MINOR_VERSION != MCU_AR_RELEASE_MINOR_VERSION)\
+ ||  (MCU_PBCFG_AR_RELEASE_PATCH_VERSION != MCU_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of PBcfg.c does not match the expected version"
+#endif
+
+/* Software Version checking between Mcu_PBcfg.c and Mcu.h files */
+#if ((MCU_PBCFG_SW_MAJOR_VERSION != MCU_SW_MAJOR_VERSION)\
+ ||  (MCU_PBCFG_SW_MINOR_VERSION != MCU_SW_MINOR_VERSION)\
+ ||  (MCU_PBCFG_SW_PATCH_VERSION != MCU_SW_PATCH_VERSION))
+  #error "The SW version of PBcfg.c does not match the expected version"
+#endif
+
+/* PB structure used with Mcu_Init API
+ * Clock settings: Oscillator, Crystal, PLL, Divider minus 1, System clock
+ * Modes: Power mode,
+ *        Clocks kept while sleeping { GPIO, Timer, Wide Timer, UART, SSI, I2C, ADC, PWM },
+ *        the GPIO ports enabled by Port and Dio and the timers enabled by Gpt are always kept,
+ *        Wake-up interrupts { 0-31, 32-63, 64-95, 96-127, 128-138 },
+ *        Deep-sleep oscillator, Deep-sleep divider minus 1 */
+const Mcu_ConfigType Mcu_Configuration = {
+                                             {
+                                                 /* PIOSC without the PLL: 16Mhz */
+                                                 { MCU_CLOCK_SOURCE_PIOSC, MCU_XTAL_16MHZ, FALSE, 0U, 16000000UL },
+                                                 /* 16Mhz crystal through the 400Mhz PLL divided by 5: 80Mhz */
+                                                 { MCU_CLOCK_SOURCE_MAIN_OSC, MCU_XTAL_16MHZ, TRUE, 4U, 80000000UL }
+                                             },
+                                             {
+                                                 /* Run: nothing is gated */
+                                                 { MCU_POWER_RUN, { 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U },
+                                                   { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+                                                   MCU_CLOCK_SOURCE_PIOSC, 0U },
+                                                 /* Sleep of the Os idle: the ports of Port and Dio stay clocked, the Gpt
+                                                  * channel and the timestamp keep counting, the SysTick and the Gpt
+                                                  * channel interrupt (94) wake the CPU */
+                                                 { MCU_POWER_SLEEP, { 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U },
+                                                   { 0x00000000, 0x00000000, 0x40000000, 0x00000000, 0x00000000 },
+                                                   MCU_CLOCK_SOURCE_PIOSC, 0U },
+                                                 /* Deep-sleep on the PIOSC: only the ports of Port and Dio (PORTF) and the
+                                                  * timers of Gpt are clocked, the PORTF interrupt (30) wakes the CPU once
+                                                  * the application enabled it (no driver does), the SysTick otherwise */
+                                                 { MCU_POWER_DEEP_SLEEP, { 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U },
+                                                   { 0x40000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+                                                   MCU_CLOCK_SOURCE_PIOSC, 0U }
+                                             }
+                                         };
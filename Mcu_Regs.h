@@ -0,0 +1,56 @@
+ /******************************************************************************
+ *
+ * Module: Mcu
+ *
+ * File Name: Mcu_Regs.h
+ *
+ * Description: Header file for TM4C123GH6PM Microcontroller - Mcu Driver Registers
+ *              (the System Control registers are in tm4c123gh6pm_registers.h)
+ *
+ * Author: Yahia Hamimi
+ ******************************************************************************/
+
+#ifndef MCU_REGS_H
+#define MCU_REGS_H
+
+#include "Std_Types.h"
+
+/* RCC: main oscillator disable, crystal value, system clock divider enable and
+ * auto clock gating (the sleep modes use the SCGC/DCGC registers instead of the RCGC ones) */
+#define MCU_RCC_MOSCDIS_MASK              0x00000001
+#define MCU_RCC_XTAL_MASK                 0x000007C0
+#define MCU_RCC_XTAL_POS                  6
+#define MCU_RCC_USESYSDIV_MASK            0x00400000
+#define MCU_RCC_ACG_MASK                  0x08000000
+
+/* RCC2: overrides the RCC fields, the 400Mhz PLL output divided by SYSDIV2:SYSDIV2LSB + 1
+ * with DIV400 or the oscillator divided by SYSDIV2 + 1 with BYPASS2 */
+#define MCU_RCC2_OSCSRC2_MASK             0x00000070
+#define MCU_RCC2_OSCSRC2_POS              4
+#define MCU_RCC2_BYPASS2_MASK             0x00000800
+#define MCU_RCC2_PWRDN2_MASK              0x00002000
+#define MCU_RCC2_SYSDIV2LSB_POS           22
+#define MCU_RCC2_SYSDIV2_POS              23
+#define MCU_RCC2_SYSDIV_MASK              0x1FC00000
+#define MCU_RCC2_DIV400_MASK              0x40000000
+#define MCU_RCC2_USERCC2_MASK             0x80000000
+
+/* RIS: the main oscillator is powered up */
+#define MCU_RIS_MOSCPUPRIS_MASK           0x00000100
+
+/* PLLSTAT: the PLL is powered and locked */
+#define MCU_PLLSTAT_LOCK_MASK             0x00000001
+
+/* DSLPCLKCFG: oscillator and divider of the system clock in deep-sleep */
+#define MCU_DSLPCLKCFG_DSOSCSRC_POS       4
+#define MCU_DSLPCLKCFG_DSDIVORIDE_POS     23
+
+/* System Control register of the Cortex-M4: WFI enters deep-sleep when SLEEPDEEP is set */
+#define MCU_SCR_REG                       (*((volatile uint32 *)0xE000ED10))
+#define MCU_SCR_SLEEPDEEP_MASK            0x00000004
+
+/* NVIC Interrupt Set/Clear Enable registers (32 interrupts each) */
+#define MCU_NVIC_EN_BASE_ADDRESS          0xE000E100
+#define MCU_NVIC_DIS_BASE_ADDRESS         0xE000E180
+
+#endif /* MCU_REGS_H */
@@ -14,42 +14,2914 @@
 #include "Button.h"
 #include "Led.h"
 #include "Gpt.h"
+#include "Mcu.h"
+#include "tm4c123gh6pm_registers.h"
+
+#if (OS_DEV_ERROR_DETECT == STD_ON)
+#include "Det.h"
+#endif
 
 /* Enable Exceptions ... This Macro enable IRQ interrupts, Programmable Systems Exceptions and Faults by clearing the I-bit in the PRIMASK. */
 #define Enable_Exceptions()    __asm(" CPSIE I ")
 
-/* Disable Exceptions ... This Macro disable IRQ interrupts, Programmable Systems Exceptions and Faults by setting the I-bit in the PRIMASK. */
-#define Disable_Exceptions()   __asm(" CPSID I ")
+/* Disable Exceptions ... This Macro disable IRQ interrupts, Programmable Systems Exceptions and Faults by setting the I-bit in the PRIMASK. */
+#define Disable_Exceptions()   __asm(" CPSID I ")
+
+/* Enable Faults ... This Macro enable Faults by clearing the F-bit in the FAULTMASK */
+#define Enable_Faults()        __asm(" CPSIE F ")
+
+/* Disable Faults ... This Macro disable Faults by setting the F-bit in the FAULTMASK */
+#define Disable_Faults()       __asm(" CPSID F ")
+
+/* Wait For Interrupt ... This Macro puts the CPU in sleep until an interrupt is pending (even if masked by PRIMASK) */
+#define Wait_For_Interrupt()   __asm(" WFI ")
+
+/* Data Memory Barrier ... This Macro completes the memory accesses before it ahead of the ones after it */
+#define Data_Memory_Barrier()  __asm(" DMB ")
+
+#if ((OS_TICKLESS_IDLE == STD_ON) && ((OS_TICKLESS_MAX_TICKS > 255U) || ((OS_TICKLESS_MAX_TICKS * OS_BASE_TIME) > 65535U)))
+  #error "OS_TICKLESS_MAX_TICKS exceeds the tick step or the SysTick_SetNextTime range"
+#endif
+
+/* Global variable store the current slot of the schedule table (Os time in OS_BASE_TIME ticks modulo the hyperperiod) */
+static uint16 g_Time_Tick_Count = 0;
+
+/* Global variables counting the ticks received by the timer interrupt and the ticks already
+ * processed by the scheduler, each one has a single writer so the difference gives the
+ * pending ticks without disabling the interrupts */
+static volatile uint8 g_Ticks_Received  = 0;
+#if (OS_PREEMPTIVE_MODE == STD_OFF)
+static uint8 g_Ticks_Processed = 0;
+#endif
+
+/* Free running Os time in OS_BASE_TIME ticks since Os_start, it never wraps in practice (64-bit) */
+STATIC volatile Os_TickType Os_TickCount = 0;
+
+/* Deadline overruns and lost activations of every task */
+STATIC Os_TaskOverrunType Os_TaskOverrun[OS_CONFIGURED_TASKS];
+
+/* Pointer to the configured tasks in the PB configuration structure */
+STATIC const Os_TaskConfigType * Os_Tasks = NULL_PTR;
+
+/* Schedule table: the set of tasks due in every OS_BASE_TIME slot of the hyperperiod */
+STATIC Os_TaskMaskType Os_ScheduleTable[OS_MAX_HYPERPERIOD_TICKS];
+
+/* Number of slots in the hyperperiod (least common multiple of the task periods in ticks) */
+STATIC uint16 Os_HyperPeriod_Ticks = 1;
+
+/* Marks the end of the alarm list of a counter */
+#define OS_INVALID_ALARM           ((Os_AlarmType)0xFF)
+
+/* Entries of the delta lists: the alarms followed by one entry per schedule table for its next expiry point */
+#define OS_ALARM_LIST_ENTRIES      (OS_CONFIGURED_ALARMS + OS_CONFIGURED_SCHEDULE_TABLES)
+#define OS_SCHEDULE_TABLE_ENTRY(Table)   ((Os_AlarmType)(OS_CONFIGURED_ALARMS + (Table)))
+
+/* Set of all the configured tasks */
+#define OS_ALL_TASKS_MASK          ((Os_TaskMaskType)(((uint64)1 << OS_CONFIGURED_TASKS) - 1U))
+
+/* Pointers to the configured counters and alarms in the PB configuration structure */
+STATIC const Os_CounterConfigType * Os_Counters = NULL_PTR;
+#if (OS_CONFIGURED_ALARMS > 0U)
+STATIC const Os_AlarmConfigType * Os_Alarms = NULL_PTR;
+#endif
+
+/* Current value of every counter */
+STATIC volatile Os_CounterTickType Os_CounterValue[OS_CONFIGURED_COUNTERS];
+
+/* Os ticks counted toward the next increment of every counter (Ticks_Per_Base prescaler) */
+STATIC Os_CounterTickType Os_CounterPrescale[OS_CONFIGURED_COUNTERS];
+
+/* Delta list of every counter: the running alarms sorted by expiry, each one keeps the counter
+ * increments left after the expiry of the previous one, so a tick only decrements the first one */
+STATIC Os_AlarmType Os_CounterHead[OS_CONFIGURED_COUNTERS];
+#if (OS_ALARM_LIST_ENTRIES > 0U)
+STATIC Os_AlarmType Os_AlarmNext[OS_ALARM_LIST_ENTRIES];
+STATIC Os_CounterTickType Os_AlarmDelta[OS_ALARM_LIST_ENTRIES];
+#endif
+
+#if (OS_CONFIGURED_ALARMS > 0U)
+/* Cycle of every running alarm, 0 for a one-shot alarm */
+STATIC Os_CounterTickType Os_AlarmCycle[OS_CONFIGURED_ALARMS];
+
+/* TRUE while the alarm is in the delta list of its counter */
+STATIC boolean Os_AlarmRunning[OS_CONFIGURED_ALARMS];
+#endif
+
+#if (OS_CONFIGURED_QUEUES > 0U)
+/* Pointer to the configured queues in the PB configuration structure */
+STATIC const Os_QueueConfigType * Os_Queues = NULL_PTR;
+
+/* Slot of the next element written by the producer and read by the consumer of every queue,
+ * each index has a single writer so no lock is needed (16-bit stores are atomic) */
+STATIC volatile uint16 Os_QueueWrite[OS_CONFIGURED_QUEUES];
+STATIC volatile uint16 Os_QueueRead[OS_CONFIGURED_QUEUES];
+#endif
+
+/* Number of slots in every level of the timer wheel */
+#define OS_TIMER_WHEEL_SLOTS       ((uint8)1 << OS_TIMER_WHEEL_BITS)
+#define OS_TIMER_WHEEL_MASK        ((Os_TimerTickType)OS_TIMER_WHEEL_SLOTS - 1U)
+
+/* Lists of the timer wheel: the slots of every level then the timers expiring in the tick in progress */
+#define OS_TIMER_EXPIRY_LIST       ((uint8)(OS_TIMER_WHEEL_LEVELS * OS_TIMER_WHEEL_SLOTS))
+#define OS_TIMER_LISTS             (OS_TIMER_EXPIRY_LIST + 1U)
+
+/* List of a stopped timer and end of a list */
+#define OS_TIMER_STOPPED           ((uint8)0xFF)
+#define OS_INVALID_TIMER           ((Os_TimerType)0xFFFF)
+
+#if (OS_CONFIGURED_TIMERS > 0U)
+/* Pointer to the configured timers in the PB configuration structure */
+STATIC const Os_TimerConfigType * Os_Timers = NULL_PTR;
+#endif
+
+/* Wheel time: number of the next Os tick processed by the timers */
+STATIC Os_TimerTickType Os_TimerTime = 0;
+
+/* Number of running timers, the wheel is not walked while there is none */
+STATIC Os_TimerType Os_TimersRunning = 0;
+
+/* Doubly linked lists of the timer wheel, a timer leaves its list without walking it.
+ * Level L holds the timers expiring in less than 32^(L+1) ticks in the slot of their expiry,
+ * a slot of the upper levels is moved down when the level below wraps to it */
+STATIC Os_TimerType Os_TimerHead[OS_TIMER_LISTS];
+#if (OS_CONFIGURED_TIMERS > 0U)
+STATIC Os_TimerType Os_TimerNext[OS_CONFIGURED_TIMERS];
+STATIC Os_TimerType Os_TimerPrev[OS_CONFIGURED_TIMERS];
+
+/* List holding every timer, OS_TIMER_STOPPED when the timer is not running */
+STATIC uint8 Os_TimerList[OS_CONFIGURED_TIMERS];
+
+/* Wheel time of the next expiry, Ticks of the last start (0 if never started) and cycle of every timer */
+STATIC Os_TimerTickType Os_TimerExpiry[OS_CONFIGURED_TIMERS];
+STATIC Os_TimerTickType Os_TimerTicks[OS_CONFIGURED_TIMERS];
+STATIC Os_TimerTickType Os_TimerCycle[OS_CONFIGURED_TIMERS];
+#endif
+
+#if (OS_CONFIGURED_SCHEDULE_TABLES > 0U)
+/* Pointer to the configured schedule tables in the PB configuration structure */
+STATIC const Os_ScheduleTableConfigType * Os_ScheduleTables = NULL_PTR;
+
+/* State of every schedule table and index of its next expiry point (Expiry_Points_Number for the end of the table) */
+STATIC Os_ScheduleTableStatusType Os_ScheduleTableState[OS_CONFIGURED_SCHEDULE_TABLES];
+STATIC uint8 Os_ScheduleTablePoint[OS_CONFIGURED_SCHEDULE_TABLES];
+#endif
+
+/* Events set for every task by Os_SetEvent, the alarms and the schedule tables, cleared by the task with Os_ClearEvent */
+STATIC volatile Os_EventMaskType Os_TaskEvents[OS_CONFIGURED_TASKS];
+
+#if (OS_PREEMPTIVE_MODE == STD_OFF)
+/* Tasks activated by Os_ActivateTask, Os_SetEvent and the alarms, the scheduler runs them after the slot in progress */
+STATIC volatile Os_TaskMaskType Os_ActivatedTasks = 0;
+#endif
+
+#if (OS_TICKLESS_IDLE == STD_ON)
+
+/* Number of ticks from every slot to the next slot having a due task */
+STATIC uint16 Os_NextDueTicks[OS_MAX_HYPERPERIOD_TICKS];
+
+/* Number of ticks covered by the SysTick period in progress */
+STATIC volatile uint8 Os_TickStep_Current = 1;
+
+/* Number of ticks covered by the SysTick period loaded at the next wrap */
+STATIC volatile uint8 Os_TickStep_Next = 1;
+
+#endif
+
+/* TRCENA bit in the Debug Exception and Monitor Control register ... enable the DWT unit */
+#define OS_DWT_TRACE_ENABLE_MASK   (0x01000000UL)
+
+/* CYCCNTENA bit in the DWT Control register ... enable the cycle counter */
+#define OS_DWT_CYCCNT_ENABLE_MASK  (0x00000001UL)
+
+#if (OS_TASK_PROFILING == STD_ON)
+
+/* Execution time statistics of every task */
+STATIC Os_TaskProfileType Os_TaskProfile[OS_CONFIGURED_TASKS];
+
+/* Cycle counter value when the task got the CPU for the last time */
+STATIC uint32 Os_TaskExec_Start[OS_CONFIGURED_TASKS];
+
+/* Cycles used by the task in its current activation (excluding the time it was preempted) */
+STATIC uint32 Os_TaskExec_Cycles[OS_CONFIGURED_TASKS];
+
+#define OS_PROFILE_TASK_START(Task)    Os_ProfileTaskStart(Task)
+#define OS_PROFILE_TASK_END(Task)      Os_ProfileTaskEnd(Task)
+
+#else
+
+/* Profiling is compiled out */
+#define OS_PROFILE_TASK_START(Task)
+#define OS_PROFILE_TASK_END(Task)
+
+#endif /* (OS_TASK_PROFILING == STD_ON) */
+
+#if (OS_CPU_LOAD_MEASUREMENT == STD_ON)
+
+/* CPU load updated at the end of every hyperperiod, to be watched in the debugger */
+volatile Os_CpuLoadType Os_CpuLoad;
+
+/* TRUE while the CPU is in the idle loop (the interrupts served meanwhile count as idle time) */
+STATIC boolean Os_CpuIdle = FALSE;
+
+/* Cycle counter value when the CPU entered the idle loop */
+STATIC uint32 Os_IdleStart = 0;
+
+/* Idle cycles of the hyperperiod in progress */
+STATIC uint32 Os_IdleCycles = 0;
+
+/* Cycle counter value and Os ticks elapsed since the start of the hyperperiod in progress */
+STATIC uint32 Os_LoadWindowStart = 0;
+STATIC uint16 Os_LoadWindowTicks = 0;
+
+/* Average load scaled by 2^OS_CPU_LOAD_AVERAGE_SHIFT to keep the fraction of the moving average */
+STATIC uint32 Os_LoadAverage_Scaled = 0;
+
+#define OS_LOAD_IDLE_ENTER()           Os_LoadIdleEnter()
+#define OS_LOAD_IDLE_EXIT()            Os_LoadIdleExit()
+
+#else
+
+/* CPU load measurement is compiled out */
+#define OS_LOAD_IDLE_ENTER()
+#define OS_LOAD_IDLE_EXIT()
+
+#endif /* (OS_CPU_LOAD_MEASUREMENT == STD_ON) */
+
+#if (OS_TRACE == STD_ON)
+
+/* Event trace ring buffer, dumped from the debugger and decoded by tools/os_trace.py */
+volatile Os_TraceBufferType Os_Trace;
+
+/* FALSE while the trace is frozen by Os_TraceStop */
+STATIC volatile boolean Os_TraceRunning = TRUE;
+
+#define OS_TRACE_RECORD(Type, Id, Data)    Os_TraceRecord((Type), (Id), (Data))
+
+#else
+
+/* Event trace is compiled out */
+#define OS_TRACE_RECORD(Type, Id, Data)
+
+#endif /* (OS_TRACE == STD_ON) */
+
+#if (OS_STACK_MONITORING == STD_ON)
+
+/* Pattern painted on the free part of the stacks */
+#define OS_STACK_PATTERN           (0xA5A5A5A5UL)
+
+/* Words left unpainted under the stack pointer when Os_start paints the main stack in use */
+#define OS_STACK_PAINT_MARGIN      (32U)
+
+/* Monitored stacks: one per task, the main stack and the interrupt stack */
+#define OS_MONITORED_STACKS        (OS_CONFIGURED_TASKS + 2U)
+
+/* Bottom and top of the .stack section reserved by the startup code (TI linker symbols) */
+extern uint32 __stack;
+extern uint32 __STACK_END;
+
+/* Lowest word and size in words of every stack, NULL_PTR for a stack not used in this kernel mode */
+STATIC uint32 * Os_StackBase[OS_MONITORED_STACKS];
+STATIC uint16 Os_StackSize[OS_MONITORED_STACKS];
+
+/* Words from the bottom of every stack never used according to the scans (high-water mark) */
+STATIC uint16 Os_StackFree[OS_MONITORED_STACKS];
+
+/* TRUE once the overflow of the stack is reported */
+STATIC boolean Os_StackOverflowed[OS_MONITORED_STACKS];
+
+/* Stack and word reached by the high-water scan in progress */
+STATIC Os_StackType Os_StackScan_Stack = 0;
+STATIC uint16 Os_StackScan_Word = 0;
+
+#endif /* (OS_STACK_MONITORING == STD_ON) */
+
+/* Implemented in Os_CortexM4.asm: mask the interrupts returning the previous PRIMASK and restore it */
+extern uint32 Os_PortDisableInterrupts(void);
+extern void Os_PortRestoreInterrupts(uint32 State);
+
+/* Implemented in Os_CortexM4.asm: raise BASEPRI returning its previous value and restore it */
+extern uint32 Os_PortRaiseBasePri(uint32 Level);
+extern void Os_PortSetBasePri(uint32 Level);
+
+/* Implemented in Os_CortexM4.asm: exception in progress, 0 for a task */
+extern uint32 Os_PortGetIpsr(void);
+
+/* Set events of a task and wake it up, implemented with the task activation of each mode */
+STATIC void Os_SetTaskEvent(Os_TaskType Task, Os_EventMaskType Mask);
+
+/* Release the resources an ending task did not release, reported to the DET */
+STATIC void Os_ReleaseTaskResources(uint8 Resource_Top);
+
+/* Number of implemented NVIC priority bits, the priority is held in the upper bits of a byte */
+#define OS_NVIC_PRIORITY_BITS      (3U)
+#define OS_NVIC_PRIORITY_LEVELS    ((uint8)1 << OS_NVIC_PRIORITY_BITS)
+
+#if (OS_CONFIGURED_RESOURCES > 0U)
+/* Pointer to the configured resources in the PB configuration structure */
+STATIC const Os_ResourceConfigType * Os_Resources = NULL_PTR;
+
+/* Resources taken, in the order they were taken, the last one is released first */
+STATIC Os_ResourceType Os_ResourceStack[OS_CONFIGURED_RESOURCES];
+#endif
+STATIC uint8 Os_ResourceTop = 0;
+
+#if (OS_CONFIGURED_RESOURCES > 0U)
+/* TRUE while the resource is taken and BASEPRI to restore when it is released */
+STATIC boolean Os_ResourceTaken[OS_CONFIGURED_RESOURCES];
+STATIC uint32 Os_ResourceBasePri[OS_CONFIGURED_RESOURCES];
+#endif
+
+#if (OS_PREEMPTIVE_MODE == STD_ON)
+
+/* Task states in preemptive mode */
+#define OS_TASK_SUSPENDED          (0U)
+#define OS_TASK_READY              (1U)
+#define OS_TASK_RUNNING            (2U)
+#define OS_TASK_WAITING            (3U)
+
+/* A task which returned from its function runs until the PendSV handler switches away from it:
+ * its context is still in use and is dropped by the switch, the task is then suspended or, if it
+ * was activated meanwhile (restarting), started again from a new context */
+#define OS_TASK_TERMINATING        (4U)
+#define OS_TASK_RESTARTING         (5U)
+
+/* The idle loop (Init Task then Os_Scheduler) is handled as the lowest priority task after the configured ones */
+#define OS_IDLE_TASK               ((Os_TaskType)OS_CONFIGURED_TASKS)
+#define OS_IDLE_PRIORITY           (0U)
+
+/* Scheduling priority of a task in the Tcb: twice its configured priority, plus one while it holds
+ * a resource of that ceiling so it keeps the CPU against the task of the ceiling priority */
+#define OS_TASK_PRIORITY(Priority)       ((uint16)(Priority) << 1)
+#define OS_CEILING_PRIORITY(Ceiling)     (OS_TASK_PRIORITY(Ceiling) | 1U)
+
+/* Initial xPSR of a task: Thumb state bit */
+#define OS_INITIAL_XPSR            (0x01000000UL)
+
+/* Initial EXC_RETURN of a task: return to thread mode using the PSP without FPU frame */
+#define OS_INITIAL_EXC_RETURN      (0xFFFFFFFDUL)
+
+/* PENDSVSET bit in the Interrupt Control and State register */
+#define OS_PENDSV_SET_MASK         (0x10000000UL)
+
+/* PendSV takes the lowest priority (7) so it switches the tasks only after all the interrupts are served */
+#define OS_PENDSV_PRIORITY_MASK    (0xFF1FFFFFUL)
+#define OS_PENDSV_PRIORITY         (7U)
+#define OS_PENDSV_PRIORITY_POS     (21U)
+
+/* Task control block of each task in preemptive mode */
+typedef struct
+{
+    /* Saved process stack pointer of the task while it is not running */
+    uint32 * Stack_Ptr;
+    /* Current state of the task (suspended, ready, running, waiting, terminating or restarting) */
+    uint8 State;
+    /* Scheduling priority of the task (OS_TASK_PRIORITY or OS_CEILING_PRIORITY) */
+    uint16 Priority;
+    /* Events the task waits for in the waiting state */
+    Os_EventMaskType Wait_Mask;
+    /* Resources taken when the task started, the task must release its own before it ends or waits */
+    uint8 Resource_Top;
+} Os_TaskControlType;
+
+STATIC Os_TaskControlType Os_Tcb[OS_CONFIGURED_TASKS + 1U];
+
+/* Task currently using the CPU */
+STATIC Os_TaskType Os_CurrentTask = OS_IDLE_TASK;
+
+/* Stack used by the interrupts and the PendSV handler */
+STATIC uint32 Os_IsrStack[OS_ISR_STACK_SIZE];
+
+/* Implemented in Os_CortexM4.asm */
+extern void Os_CpuSwitchToProcessStack(uint32 * Isr_Stack_Top);
+
+#if (OS_CONFIGURED_RESOURCES > 0U)
+/* Task priority to restore when the resource is released */
+STATIC uint16 Os_ResourcePriority[OS_CONFIGURED_RESOURCES];
+#endif
+
+#endif /* (OS_PREEMPTIVE_MODE == STD_ON) */
+
+/*********************************************************************************************/
+/* Description: Greatest common divisor used to compute the hyperperiod */
+STATIC uint16 Os_Gcd(uint16 a, uint16 b)
+{
+    uint16 remainder;
+
+    while(b != 0)
+    {
+        remainder = a % b;
+        a = b;
+        b = remainder;
+    }
+    return a;
+}
+
+/*********************************************************************************************/
+/* Description: Compute the hyperperiod of the configured tasks and fill the schedule table
+ *              with the tasks due in each slot, so the scheduler dispatches with one lookup */
+STATIC Std_ReturnType Os_BuildScheduleTable(const Os_ConfigType * ConfigPtr)
+{
+    uint32 hyper_period = 1;
+    uint16 period_ticks;
+    uint16 slot;
+    uint8  task;
+
+    Os_Tasks = ConfigPtr->Tasks;
+
+    for(task = 0; task < OS_CONFIGURED_TASKS; task++)
+    {
+        /* Period and offset must be multiples of the Os tick and the offset inside the period,
+         * a task with no period is only activated by Os_ActivateTask, Os_SetEvent and the alarms */
+        if(((Os_Tasks[task].Period % OS_BASE_TIME) != 0) || ((Os_Tasks[task].Offset % OS_BASE_TIME) != 0)
+           || ((Os_Tasks[task].Period == 0) && (Os_Tasks[task].Offset != 0))
+           || ((Os_Tasks[task].Period != 0) && (Os_Tasks[task].Offset >= Os_Tasks[task].Period)))
+        {
+            return E_NOT_OK;
+        }
+
+        if(Os_Tasks[task].Period != 0)
+        {
+            period_ticks = Os_Tasks[task].Period / OS_BASE_TIME;
+            hyper_period = (hyper_period / Os_Gcd((uint16)hyper_period, period_ticks)) * period_ticks;
+
+            if(hyper_period > OS_MAX_HYPERPERIOD_TICKS)
+            {
+                return E_NOT_OK;
+            }
+        }
+
+#if (OS_PREEMPTIVE_MODE == STD_ON)
+        /* Every task needs its own stack and a unique priority above the idle loop */
+        if((Os_Tasks[task].Stack_Ptr == NULL_PTR) || (Os_Tasks[task].Priority == OS_IDLE_PRIORITY))
+        {
+            return E_NOT_OK;
+        }
+        for(slot = 0; slot < task; slot++)
+        {
+            if(Os_Tasks[slot].Priority == Os_Tasks[task].Priority)
+            {
+                return E_NOT_OK;
+            }
+        }
+#endif
+    }
+
+    Os_HyperPeriod_Ticks = (uint16)hyper_period;
+
+    for(slot = 0; slot < Os_HyperPeriod_Ticks; slot++)
+    {
+        Os_ScheduleTable[slot] = 0;
+        for(task = 0; task < OS_CONFIGURED_TASKS; task++)
+        {
+            /* Task is due in the slot when the slot time matches its offset inside the period */
+            if((Os_Tasks[task].Period != 0)
+               && ((slot % (Os_Tasks[task].Period / OS_BASE_TIME)) == (Os_Tasks[task].Offset / OS_BASE_TIME)))
+            {
+                Os_ScheduleTable[slot] |= ((Os_TaskMaskType)1 << task);
+            }
+        }
+    }
+
+#if (OS_TICKLESS_IDLE == STD_ON)
+    /* Distance to the next due slot, searched backward from the end of two hyperperiods */
+    Os_NextDueTicks[Os_HyperPeriod_Ticks - 1U] = Os_HyperPeriod_Ticks;
+    for(slot = (2U * Os_HyperPeriod_Ticks) - 1U; slot > 0; slot--)
+    {
+        if(Os_ScheduleTable[slot % Os_HyperPeriod_Ticks] != 0)
+        {
+            Os_NextDueTicks[(slot - 1U) % Os_HyperPeriod_Ticks] = 1;
+        }
+        else
+        {
+            Os_NextDueTicks[(slot - 1U) % Os_HyperPeriod_Ticks] = Os_NextDueTicks[slot % Os_HyperPeriod_Ticks] + 1U;
+        }
+    }
+#endif
+    return E_OK;
+}
+
+/*********************************************************************************************/
+/* Description: Count an overrun of every task in the set and report it through the hook */
+STATIC void Os_ReportOverrun(Os_TaskMaskType Tasks, uint8 Reason)
+{
+    Os_TaskType task;
+
+    for(task = 0; Tasks != 0; task++, Tasks >>= 1)
+    {
+        if(Tasks & 1U)
+        {
+            OS_TRACE_RECORD(OS_TRACE_TYPE_OVERRUN, task, Reason);
+            if(Reason == OS_OVERRUN_DEADLINE)
+            {
+                Os_TaskOverrun[task].Deadline_Overruns++;
+            }
+            else
+            {
+                Os_TaskOverrun[task].Lost_Activations++;
+            }
+#if (OS_OVERRUN_HOOK == STD_ON)
+            Os_OverrunHook(task, Reason);
+#endif
+        }
+    }
+}
+
+/*********************************************************************************************/
+Std_ReturnType Os_GetTaskOverruns(Os_TaskType TaskId, Os_TaskOverrunType * OverrunPtr)
+{
+    uint32 interrupt_state;
+
+#if (OS_DEV_ERROR_DETECT == STD_ON)
+    if(TaskId >= OS_CONFIGURED_TASKS)
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_GET_TASK_OVERRUNS_SID, OS_E_PARAM_TASK);
+        return E_NOT_OK;
+    }
+    if(NULL_PTR == OverrunPtr)
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_GET_TASK_OVERRUNS_SID, OS_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+#endif
+
+    interrupt_state = Os_PortDisableInterrupts();
+    OverrunPtr->Deadline_Overruns = Os_TaskOverrun[TaskId].Deadline_Overruns;
+    OverrunPtr->Lost_Activations  = Os_TaskOverrun[TaskId].Lost_Activations;
+    Os_PortRestoreInterrupts(interrupt_state);
+    return E_OK;
+}
+
+/*********************************************************************************************/
+Os_TickType Os_GetTickCount(void)
+{
+    Os_TickType ticks;
+    uint32 interrupt_state;
+
+    /* The 64-bit counter is written by the tick interrupt in two stores, read it with the
+     * interrupts masked, the previous mask is restored so the caller may be an ISR */
+    interrupt_state = Os_PortDisableInterrupts();
+    ticks = Os_TickCount;
+    Os_PortRestoreInterrupts(interrupt_state);
+
+    return ticks;
+}
+
+/*********************************************************************************************/
+Os_TimeType Os_GetTime(void)
+{
+    return Os_GetTickCount() * OS_BASE_TIME;
+}
+
+/*********************************************************************************************/
+Os_TimeType Os_GetElapsedTime(Os_TimeType * PreviousTimePtr)
+{
+    Os_TimeType current_time;
+    Os_TimeType elapsed_time;
+
+#if (OS_DEV_ERROR_DETECT == STD_ON)
+    if(NULL_PTR == PreviousTimePtr)
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_GET_ELAPSED_TIME_SID, OS_E_PARAM_POINTER);
+        return 0;
+    }
+#endif
+
+    current_time = Os_GetTime();
+    elapsed_time = current_time - *PreviousTimePtr;
+    *PreviousTimePtr = current_time;
+
+    return elapsed_time;
+}
+
+#if (OS_CONFIGURED_ALARMS > 0U)
+/*********************************************************************************************/
+/* Description: Check the cycle of an alarm against the limits of its counter (0 is a one-shot alarm) */
+STATIC boolean Os_IsValidCycle(const Os_CounterConfigType * Counter, Os_CounterTickType Cycle)
+{
+    return (boolean)((Cycle == 0) || ((Cycle >= Counter->Min_Cycle) && (Cycle <= Counter->Max_Allowed_Value)));
+}
+#endif
+
+#if (OS_ALARM_LIST_ENTRIES > 0U)
+/*********************************************************************************************/
+/* Description: Counter increments from the current value of the counter to an absolute value,
+ *              the current value itself is reached again after a full round of the counter */
+STATIC Os_CounterTickType Os_AbsoluteToDelta(Os_CounterType Counter, Os_CounterTickType Start)
+{
+    Os_CounterTickType value = Os_CounterValue[Counter];
+
+    if(Start > value)
+    {
+        return Start - value;
+    }
+    return (Os_Counters[Counter].Max_Allowed_Value - value) + Start + 1U;
+}
+
+/*********************************************************************************************/
+/* Description: Insert the alarm in the delta list of its counter to expire after Delta increments,
+ *              alarms expiring together keep the order they were started in */
+STATIC void Os_InsertAlarm(Os_CounterType Counter, Os_AlarmType Alarm, Os_CounterTickType Delta)
+{
+    Os_AlarmType * link = &Os_CounterHead[Counter];
+
+    while((*link != OS_INVALID_ALARM) && (Os_AlarmDelta[*link] <= Delta))
+    {
+        Delta -= Os_AlarmDelta[*link];
+        link = &Os_AlarmNext[*link];
+    }
+
+    /* The following alarm now counts from the expiry of the new one */
+    if(*link != OS_INVALID_ALARM)
+    {
+        Os_AlarmDelta[*link] -= Delta;
+    }
+    Os_AlarmDelta[Alarm] = Delta;
+    Os_AlarmNext[Alarm]  = *link;
+    *link = Alarm;
+}
+
+/*********************************************************************************************/
+/* Description: Remove a running alarm from the delta list of its counter */
+STATIC void Os_RemoveAlarm(Os_CounterType Counter, Os_AlarmType Alarm)
+{
+    Os_AlarmType * link = &Os_CounterHead[Counter];
+
+    while(*link != Alarm)
+    {
+        link = &Os_AlarmNext[*link];
+    }
+
+    /* The following alarm takes over the increments left to the removed one */
+    *link = Os_AlarmNext[Alarm];
+    if(*link != OS_INVALID_ALARM)
+    {
+        Os_AlarmDelta[*link] += Os_AlarmDelta[Alarm];
+    }
+}
+#endif
+
+#if (OS_CONFIGURED_ALARMS > 0U)
+/*********************************************************************************************/
+/* Description: Start an alarm, must be called with the interrupts disabled */
+STATIC Std_ReturnType Os_StartAlarm(Os_AlarmType Alarm, Os_CounterTickType Delta, Os_CounterTickType Cycle)
+{
+    if(Os_AlarmRunning[Alarm])
+    {
+        return E_NOT_OK;
+    }
+    Os_AlarmCycle[Alarm]   = Cycle;
+    Os_AlarmRunning[Alarm] = TRUE;
+    Os_InsertAlarm(Os_Alarms[Alarm].Counter, Alarm, Delta);
+    return E_OK;
+}
+#endif
+
+#if (OS_CONFIGURED_SCHEDULE_TABLES > 0U)
+/*********************************************************************************************/
+/* Description: Process the expiry point of a schedule table which reached its offset and insert
+ *              the table again for its next expiry point. The end of the table is handled as an
+ *              expiry point without action at the Duration offset: a repeating table restarts from
+ *              its first expiry point and a single-shot table stops. Returns the activated tasks */
+STATIC Os_TaskMaskType Os_ProcessScheduleTable(Os_ScheduleTableType Table)
+{
+    const Os_ScheduleTableConfigType * table = &Os_ScheduleTables[Table];
+    const Os_ExpiryPointConfigType * point;
+    Os_TaskMaskType activated_tasks = 0;
+    Os_CounterTickType delta;
+    Os_TaskType task;
+    uint8 next_point;
+
+    do
+    {
+        next_point = Os_ScheduleTablePoint[Table];
+        if(next_point < table->Expiry_Points_Number)
+        {
+            point = &table->Expiry_Points[next_point];
+            activated_tasks |= point->Tasks;
+            for(task = 0; task < OS_CONFIGURED_TASKS; task++)
+            {
+                if((point->Event_Tasks >> task) & 1U)
+                {
+                    Os_SetTaskEvent(task, point->Event);
+                }
+            }
+
+            /* Delay to the next expiry point, or to the end of the table after the last one */
+            next_point++;
+            if(next_point < table->Expiry_Points_Number)
+            {
+                delta = table->Expiry_Points[next_point].Offset - point->Offset;
+            }
+            else
+            {
+                delta = table->Duration - point->Offset;
+            }
+        }
+        else if(table->Repeating)
+        {
+            next_point = 0;
+            delta = table->Expiry_Points[0].Offset;
+        }
+        else
+        {
+            Os_ScheduleTableState[Table] = OS_SCHEDULETABLE_STOPPED;
+            return activated_tasks;
+        }
+        Os_ScheduleTablePoint[Table] = next_point;
+    } while(delta == 0);
+
+    Os_InsertAlarm(table->Counter, OS_SCHEDULE_TABLE_ENTRY(Table), delta);
+    return activated_tasks;
+}
+#endif
+
+#if (OS_ALARM_LIST_ENTRIES > 0U)
+/*********************************************************************************************/
+/* Description: Run the actions of the alarms at the head of the delta list which reached their expiry,
+ *              the cyclic ones are inserted again before their action so a callback may cancel them */
+STATIC Os_TaskMaskType Os_ExpireAlarms(Os_CounterType Counter)
+{
+    Os_TaskMaskType activated_tasks = 0;
+    Os_AlarmType alarm = Os_CounterHead[Counter];
+
+    while((alarm != OS_INVALID_ALARM) && (Os_AlarmDelta[alarm] == 0))
+    {
+        Os_CounterHead[Counter] = Os_AlarmNext[alarm];
+
+#if (OS_CONFIGURED_ALARMS > 0U)
+        if(alarm < OS_CONFIGURED_ALARMS)
+        {
+            if(Os_AlarmCycle[alarm] != 0)
+            {
+                Os_InsertAlarm(Counter, alarm, Os_AlarmCycle[alarm]);
+            }
+            else
+            {
+                Os_AlarmRunning[alarm] = FALSE;
+            }
+
+            switch(Os_Alarms[alarm].Action)
+            {
+                case OS_ALARM_ACTION_SETEVENT:
+                    Os_SetTaskEvent(Os_Alarms[alarm].Task, Os_Alarms[alarm].Event);
+                    break;
+                case OS_ALARM_ACTION_CALLBACK:
+                    Os_Alarms[alarm].Callback();
+                    break;
+                default:
+                    activated_tasks |= ((Os_TaskMaskType)1 << Os_Alarms[alarm].Task);
+                    break;
+            }
+        }
+        else
+#endif
+        {
+#if (OS_CONFIGURED_SCHEDULE_TABLES > 0U)
+            /* Entry of a schedule table */
+            activated_tasks |= Os_ProcessScheduleTable((Os_ScheduleTableType)(alarm - OS_CONFIGURED_ALARMS));
+#endif
+        }
+        alarm = Os_CounterHead[Counter];
+    }
+    return activated_tasks;
+}
+#endif
+
+/*********************************************************************************************/
+/* Description: Called by the tick interrupt to advance every counter by the Os ticks elapsed,
+ *              one increment only decrements the first alarm of the delta list whatever the
+ *              number of running alarms. Returns the tasks activated by the expired alarms */
+STATIC Os_TaskMaskType Os_AdvanceCounters(uint8 Ticks)
+{
+    Os_TaskMaskType activated_tasks = 0;
+    Os_CounterType counter;
+
+    for(counter = 0; counter < OS_CONFIGURED_COUNTERS; counter++)
+    {
+        Os_CounterPrescale[counter] += Ticks;
+        while(Os_CounterPrescale[counter] >= Os_Counters[counter].Ticks_Per_Base)
+        {
+            Os_CounterPrescale[counter] -= Os_Counters[counter].Ticks_Per_Base;
+
+            if(Os_CounterValue[counter] >= Os_Counters[counter].Max_Allowed_Value)
+            {
+                Os_CounterValue[counter] = 0;
+            }
+            else
+            {
+                Os_CounterValue[counter]++;
+            }
+
+#if (OS_ALARM_LIST_ENTRIES > 0U)
+            if(Os_CounterHead[counter] != OS_INVALID_ALARM)
+            {
+                Os_AlarmDelta[Os_CounterHead[counter]]--;
+                activated_tasks |= Os_ExpireAlarms(counter);
+            }
+#endif
+        }
+    }
+    return activated_tasks;
+}
+
+/*********************************************************************************************/
+/* Description: Check the counters and alarms configuration and start the autostart alarms */
+STATIC Std_ReturnType Os_InitAlarms(const Os_ConfigType * ConfigPtr)
+{
+    const Os_CounterConfigType * counter;
+    Os_CounterType counter_id;
+#if (OS_CONFIGURED_ALARMS > 0U)
+    const Os_AlarmConfigType * alarm;
+    Os_AlarmType alarm_id;
+#endif
+
+    Os_Counters = ConfigPtr->Counters;
+
+    for(counter_id = 0; counter_id < OS_CONFIGURED_COUNTERS; counter_id++)
+    {
+        counter = &Os_Counters[counter_id];
+
+        /* A full counter round must fit in Os_CounterTickType */
+        if((counter->Max_Allowed_Value == 0) || (counter->Max_Allowed_Value == 0xFFFFFFFFUL)
+           || (counter->Ticks_Per_Base == 0) || (counter->Min_Cycle == 0) || (counter->Min_Cycle > counter->Max_Allowed_Value))
+        {
+            return E_NOT_OK;
+        }
+        Os_CounterValue[counter_id]    = 0;
+        Os_CounterPrescale[counter_id] = 0;
+        Os_CounterHead[counter_id]     = OS_INVALID_ALARM;
+    }
+
+#if (OS_CONFIGURED_ALARMS > 0U)
+    Os_Alarms = ConfigPtr->Alarms;
+
+    for(alarm_id = 0; alarm_id < OS_CONFIGURED_ALARMS; alarm_id++)
+    {
+        alarm = &Os_Alarms[alarm_id];
+        Os_AlarmRunning[alarm_id] = FALSE;
+
+        if((alarm->Counter >= OS_CONFIGURED_COUNTERS)
+           || ((alarm->Action == OS_ALARM_ACTION_CALLBACK) && (alarm->Callback == NULL_PTR))
+           || ((alarm->Action != OS_ALARM_ACTION_CALLBACK) && (alarm->Task >= OS_CONFIGURED_TASKS))
+           || (alarm->Action > OS_ALARM_ACTION_CALLBACK))
+        {
+            return E_NOT_OK;
+        }
+    }
+
+    for(alarm_id = 0; alarm_id < OS_CONFIGURED_ALARMS; alarm_id++)
+    {
+        alarm = &Os_Alarms[alarm_id];
+        counter = &Os_Counters[alarm->Counter];
+
+        if(alarm->AutoStart == OS_ALARM_AUTOSTART_NONE)
+        {
+            continue;
+        }
+        if((alarm->Alarm_Time > counter->Max_Allowed_Value) || (!Os_IsValidCycle(counter, alarm->Cycle_Time))
+           || ((alarm->AutoStart == OS_ALARM_AUTOSTART_RELATIVE) && (alarm->Alarm_Time == 0)))
+        {
+            return E_NOT_OK;
+        }
+
+        /* The tick is not started yet, no need to disable the interrupts */
+        if(alarm->AutoStart == OS_ALARM_AUTOSTART_RELATIVE)
+        {
+            (void)Os_StartAlarm(alarm_id, alarm->Alarm_Time, alarm->Cycle_Time);
+        }
+        else
+        {
+            (void)Os_StartAlarm(alarm_id, Os_AbsoluteToDelta(alarm->Counter, alarm->Alarm_Time), alarm->Cycle_Time);
+        }
+    }
+#endif
+    return E_OK;
+}
+
+#if (OS_CONFIGURED_SCHEDULE_TABLES > 0U)
+/*********************************************************************************************/
+/* Description: Counter value reached Offset increments after Start, wrapping after the maximum value */
+STATIC Os_CounterTickType Os_AddCounterTicks(Os_CounterType Counter, Os_CounterTickType Start, Os_CounterTickType Offset)
+{
+    Os_CounterTickType max_value = Os_Counters[Counter].Max_Allowed_Value;
+
+    if(Start > (max_value - Offset))
+    {
+        return Start - (max_value - Offset) - 1U;
+    }
+    return Start + Offset;
+}
+
+/*********************************************************************************************/
+/* Description: Start a schedule table with its first expiry point Delta increments from now,
+ *              must be called with the interrupts disabled */
+STATIC Std_ReturnType Os_StartScheduleTable(Os_ScheduleTableType Table, Os_CounterTickType Delta)
+{
+    if(Os_ScheduleTableState[Table] != OS_SCHEDULETABLE_STOPPED)
+    {
+        return E_NOT_OK;
+    }
+    Os_ScheduleTablePoint[Table] = 0;
+    Os_ScheduleTableState[Table] = OS_SCHEDULETABLE_RUNNING;
+    Os_InsertAlarm(Os_ScheduleTables[Table].Counter, OS_SCHEDULE_TABLE_ENTRY(Table), Delta);
+    return E_OK;
+}
+#endif
+
+/*********************************************************************************************/
+/* Description: Check the schedule tables configuration and start the autostart tables,
+ *              called after Os_InitAlarms which initializes the counters */
+STATIC Std_ReturnType Os_InitScheduleTables(const Os_ConfigType * ConfigPtr)
+{
+#if (OS_CONFIGURED_SCHEDULE_TABLES > 0U)
+    const Os_ScheduleTableConfigType * table;
+    const Os_CounterConfigType * counter;
+    Os_ScheduleTableType table_id;
+    Os_CounterTickType first_offset;
+    uint8 point;
+
+    Os_ScheduleTables = ConfigPtr->ScheduleTables;
+
+    for(table_id = 0; table_id < OS_CONFIGURED_SCHEDULE_TABLES; table_id++)
+    {
+        table = &Os_ScheduleTables[table_id];
+        Os_ScheduleTableState[table_id] = OS_SCHEDULETABLE_STOPPED;
+
+        if((table->Counter >= OS_CONFIGURED_COUNTERS) || (table->Expiry_Points == NULL_PTR)
+           || (table->Expiry_Points_Number == 0) || (table->Duration == 0)
+           || (table->Duration > Os_Counters[table->Counter].Max_Allowed_Value))
+        {
+            return E_NOT_OK;
+        }
+
+        /* Expiry points sorted by offset inside the table, activating or setting events of configured tasks only */
+        for(point = 0; point < table->Expiry_Points_Number; point++)
+        {
+            if((table->Expiry_Points[point].Offset > table->Duration)
+               || ((point > 0) && (table->Expiry_Points[point].Offset <= table->Expiry_Points[point - 1U].Offset))
+               || (((table->Expiry_Points[point].Tasks | table->Expiry_Points[point].Event_Tasks) & ~OS_ALL_TASKS_MASK) != 0))
+            {
+                return E_NOT_OK;
+            }
+        }
+    }
+
+    for(table_id = 0; table_id < OS_CONFIGURED_SCHEDULE_TABLES; table_id++)
+    {
+        table = &Os_ScheduleTables[table_id];
+        counter = &Os_Counters[table->Counter];
+        first_offset = table->Expiry_Points[0].Offset;
+
+        if(table->AutoStart == OS_SCHEDULETABLE_AUTOSTART_NONE)
+        {
+            continue;
+        }
+        if((table->Start_Value > counter->Max_Allowed_Value)
+           || ((table->AutoStart == OS_SCHEDULETABLE_AUTOSTART_RELATIVE)
+               && ((table->Start_Value == 0) || (table->Start_Value > (counter->Max_Allowed_Value - first_offset)))))
+        {
+            return E_NOT_OK;
+        }
+
+        /* The tick is not started yet, no need to disable the interrupts */
+        if(table->AutoStart == OS_SCHEDULETABLE_AUTOSTART_RELATIVE)
+        {
+            (void)Os_StartScheduleTable(table_id, table->Start_Value + first_offset);
+        }
+        else
+        {
+            (void)Os_StartScheduleTable(table_id,
+                                        Os_AbsoluteToDelta(table->Counter, Os_AddCounterTicks(table->Counter, table->Start_Value, first_offset)));
+        }
+    }
+#else
+    (void)ConfigPtr;
+#endif
+    return E_OK;
+}
+
+#if (OS_CONFIGURED_ALARMS > 0U)
+/*********************************************************************************************/
+Std_ReturnType Os_SetRelAlarm(Os_AlarmType AlarmId, Os_CounterTickType Increment, Os_CounterTickType Cycle)
+{
+    Std_ReturnType ret;
+    uint32 interrupt_state;
+
+#if (OS_DEV_ERROR_DETECT == STD_ON)
+    if(AlarmId >= OS_CONFIGURED_ALARMS)
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_SET_REL_ALARM_SID, OS_E_PARAM_ALARM);
+        return E_NOT_OK;
+    }
+    if((Increment == 0) || (Increment > Os_Counters[Os_Alarms[AlarmId].Counter].Max_Allowed_Value)
+       || (!Os_IsValidCycle(&Os_Counters[Os_Alarms[AlarmId].Counter], Cycle)))
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_SET_REL_ALARM_SID, OS_E_PARAM_VALUE);
+        return E_NOT_OK;
+    }
+#endif
+
+    interrupt_state = Os_PortDisableInterrupts();
+    ret = Os_StartAlarm(AlarmId, Increment, Cycle);
+    Os_PortRestoreInterrupts(interrupt_state);
+
+#if (OS_DEV_ERROR_DETECT == STD_ON)
+    if(ret != E_OK)
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_SET_REL_ALARM_SID, OS_E_ALARM_STATE);
+    }
+#endif
+    return ret;
+}
+
+/*********************************************************************************************/
+Std_ReturnType Os_SetAbsAlarm(Os_AlarmType AlarmId, Os_CounterTickType Start, Os_CounterTickType Cycle)
+{
+    Std_ReturnType ret;
+    uint32 interrupt_state;
+
+#if (OS_DEV_ERROR_DETECT == STD_ON)
+    if(AlarmId >= OS_CONFIGURED_ALARMS)
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_SET_ABS_ALARM_SID, OS_E_PARAM_ALARM);
+        return E_NOT_OK;
+    }
+    if((Start > Os_Counters[Os_Alarms[AlarmId].Counter].Max_Allowed_Value)
+       || (!Os_IsValidCycle(&Os_Counters[Os_Alarms[AlarmId].Counter], Cycle)))
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_SET_ABS_ALARM_SID, OS_E_PARAM_VALUE);
+        return E_NOT_OK;
+    }
+#endif
+
+    /* The counter value must not change between the conversion and the insertion */
+    interrupt_state = Os_PortDisableInterrupts();
+    ret = Os_StartAlarm(AlarmId, Os_AbsoluteToDelta(Os_Alarms[AlarmId].Counter, Start), Cycle);
+    Os_PortRestoreInterrupts(interrupt_state);
+
+#if (OS_DEV_ERROR_DETECT == STD_ON)
+    if(ret != E_OK)
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_SET_ABS_ALARM_SID, OS_E_ALARM_STATE);
+    }
+#endif
+    return ret;
+}
+
+/*********************************************************************************************/
+Std_ReturnType Os_CancelAlarm(Os_AlarmType AlarmId)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint32 interrupt_state;
+
+#if (OS_DEV_ERROR_DETECT == STD_ON)
+    if(AlarmId >= OS_CONFIGURED_ALARMS)
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_CANCEL_ALARM_SID, OS_E_PARAM_ALARM);
+        return E_NOT_OK;
+    }
+#endif
+
+    interrupt_state = Os_PortDisableInterrupts();
+    if(Os_AlarmRunning[AlarmId])
+    {
+        Os_RemoveAlarm(Os_Alarms[AlarmId].Counter, AlarmId);
+        Os_AlarmRunning[AlarmId] = FALSE;
+        ret = E_OK;
+    }
+    Os_PortRestoreInterrupts(interrupt_state);
+
+#if (OS_DEV_ERROR_DETECT == STD_ON)
+    if(ret != E_OK)
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_CANCEL_ALARM_SID, OS_E_ALARM_STATE);
+    }
+#endif
+    return ret;
+}
+
+/*********************************************************************************************/
+Std_ReturnType Os_GetAlarm(Os_AlarmType AlarmId, Os_CounterTickType * TicksPtr)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    Os_CounterTickType ticks = 0;
+    Os_AlarmType alarm;
+    uint32 interrupt_state;
+
+#if (OS_DEV_ERROR_DETECT == STD_ON)
+    if(AlarmId >= OS_CONFIGURED_ALARMS)
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_GET_ALARM_SID, OS_E_PARAM_ALARM);
+        return E_NOT_OK;
+    }
+    if(NULL_PTR == TicksPtr)
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_GET_ALARM_SID, OS_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+#endif
+
+    /* The time left is the sum of the deltas up to the alarm */
+    interrupt_state = Os_PortDisableInterrupts();
+    if(Os_AlarmRunning[AlarmId])
+    {
+        alarm = Os_CounterHead[Os_Alarms[AlarmId].Counter];
+        while(alarm != AlarmId)
+        {
+            ticks += Os_AlarmDelta[alarm];
+            alarm = Os_AlarmNext[alarm];
+        }
+        *TicksPtr = ticks + Os_AlarmDelta[AlarmId];
+        ret = E_OK;
+    }
+    Os_PortRestoreInterrupts(interrupt_state);
+
+#if (OS_DEV_ERROR_DETECT == STD_ON)
+    if(ret != E_OK)
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_GET_ALARM_SID, OS_E_ALARM_STATE);
+    }
+#endif
+    return ret;
+}
+#endif
+
+/*********************************************************************************************/
+Std_ReturnType Os_GetCounterValue(Os_CounterType CounterId, Os_CounterTickType * ValuePtr)
+{
+#if (OS_DEV_ERROR_DETECT == STD_ON)
+    if(CounterId >= OS_CONFIGURED_COUNTERS)
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_GET_COUNTER_VALUE_SID, OS_E_PARAM_COUNTER);
+        return E_NOT_OK;
+    }
+    if(NULL_PTR == ValuePtr)
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_GET_COUNTER_VALUE_SID, OS_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+#endif
+
+    /* Single 32-bit read, no critical section needed */
+    *ValuePtr = Os_CounterValue[CounterId];
+    return E_OK;
+}
+
+#if (OS_CONFIGURED_SCHEDULE_TABLES > 0U)
+/*********************************************************************************************/
+Std_ReturnType Os_StartScheduleTableRel(Os_ScheduleTableType TableId, Os_CounterTickType Offset)
+{
+    Std_ReturnType ret;
+    Os_CounterTickType first_offset;
+    uint32 interrupt_state;
+
+#if (OS_DEV_ERROR_DETECT == STD_ON)
+    if(TableId >= OS_CONFIGURED_SCHEDULE_TABLES)
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_START_SCHEDULE_TABLE_REL_SID, OS_E_PARAM_SCHEDULE_TABLE);
+        return E_NOT_OK;
+    }
+#endif
+
+    first_offset = Os_ScheduleTables[TableId].Expiry_Points[0].Offset;
+
+#if (OS_DEV_ERROR_DETECT == STD_ON)
+    if((Offset == 0) || (Offset > (Os_Counters[Os_ScheduleTables[TableId].Counter].Max_Allowed_Value - first_offset)))
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_START_SCHEDULE_TABLE_REL_SID, OS_E_PARAM_VALUE);
+        return E_NOT_OK;
+    }
+#endif
+
+    interrupt_state = Os_PortDisableInterrupts();
+    ret = Os_StartScheduleTable(TableId, Offset + first_offset);
+    Os_PortRestoreInterrupts(interrupt_state);
+
+#if (OS_DEV_ERROR_DETECT == STD_ON)
+    if(ret != E_OK)
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_START_SCHEDULE_TABLE_REL_SID, OS_E_SCHEDULE_TABLE_STATE);
+    }
+#endif
+    return ret;
+}
+
+/*********************************************************************************************/
+Std_ReturnType Os_StartScheduleTableAbs(Os_ScheduleTableType TableId, Os_CounterTickType Start)
+{
+    Std_ReturnType ret;
+    Os_CounterType counter;
+    uint32 interrupt_state;
+
+#if (OS_DEV_ERROR_DETECT == STD_ON)
+    if(TableId >= OS_CONFIGURED_SCHEDULE_TABLES)
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_START_SCHEDULE_TABLE_ABS_SID, OS_E_PARAM_SCHEDULE_TABLE);
+        return E_NOT_OK;
+    }
+    if(Start > Os_Counters[Os_ScheduleTables[TableId].Counter].Max_Allowed_Value)
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_START_SCHEDULE_TABLE_ABS_SID, OS_E_PARAM_VALUE);
+        return E_NOT_OK;
+    }
+#endif
+
+    counter = Os_ScheduleTables[TableId].Counter;
+
+    /* The table starts when the counter reaches Start, its first expiry point follows after its offset */
+    interrupt_state = Os_PortDisableInterrupts();
+    ret = Os_StartScheduleTable(TableId,
+                                Os_AbsoluteToDelta(counter, Os_AddCounterTicks(counter, Start, Os_ScheduleTables[TableId].Expiry_Points[0].Offset)));
+    Os_PortRestoreInterrupts(interrupt_state);
+
+#if (OS_DEV_ERROR_DETECT == STD_ON)
+    if(ret != E_OK)
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_START_SCHEDULE_TABLE_ABS_SID, OS_E_SCHEDULE_TABLE_STATE);
+    }
+#endif
+    return ret;
+}
+
+/*********************************************************************************************/
+Std_ReturnType Os_StopScheduleTable(Os_ScheduleTableType TableId)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint32 interrupt_state;
+
+#if (OS_DEV_ERROR_DETECT == STD_ON)
+    if(TableId >= OS_CONFIGURED_SCHEDULE_TABLES)
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_STOP_SCHEDULE_TABLE_SID, OS_E_PARAM_SCHEDULE_TABLE);
+        return E_NOT_OK;
+    }
+#endif
+
+    interrupt_state = Os_PortDisableInterrupts();
+    if(Os_ScheduleTableState[TableId] != OS_SCHEDULETABLE_STOPPED)
+    {
+        Os_RemoveAlarm(Os_ScheduleTables[TableId].Counter, OS_SCHEDULE_TABLE_ENTRY(TableId));
+        Os_ScheduleTableState[TableId] = OS_SCHEDULETABLE_STOPPED;
+        ret = E_OK;
+    }
+    Os_PortRestoreInterrupts(interrupt_state);
+
+#if (OS_DEV_ERROR_DETECT == STD_ON)
+    if(ret != E_OK)
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_STOP_SCHEDULE_TABLE_SID, OS_E_SCHEDULE_TABLE_STATE);
+    }
+#endif
+    return ret;
+}
+
+/*********************************************************************************************/
+Std_ReturnType Os_GetScheduleTableStatus(Os_ScheduleTableType TableId, Os_ScheduleTableStatusType * StatusPtr)
+{
+#if (OS_DEV_ERROR_DETECT == STD_ON)
+    if(TableId >= OS_CONFIGURED_SCHEDULE_TABLES)
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_GET_SCHEDULE_TABLE_STATUS_SID, OS_E_PARAM_SCHEDULE_TABLE);
+        return E_NOT_OK;
+    }
+    if(NULL_PTR == StatusPtr)
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_GET_SCHEDULE_TABLE_STATUS_SID, OS_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+#endif
+
+    *StatusPtr = Os_ScheduleTableState[TableId];
+    return E_OK;
+}
+#endif
+
+/*********************************************************************************************/
+Std_ReturnType Os_GetEvent(Os_TaskType TaskId, Os_EventMaskType * EventPtr)
+{
+#if (OS_DEV_ERROR_DETECT == STD_ON)
+    if(TaskId >= OS_CONFIGURED_TASKS)
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_GET_EVENT_SID, OS_E_PARAM_TASK);
+        return E_NOT_OK;
+    }
+    if(NULL_PTR == EventPtr)
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_GET_EVENT_SID, OS_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+#endif
+
+    *EventPtr = Os_TaskEvents[TaskId];
+    return E_OK;
+}
+
+/*********************************************************************************************/
+Std_ReturnType Os_ClearEvent(Os_TaskType TaskId, Os_EventMaskType Mask)
+{
+    uint32 interrupt_state;
+
+#if (OS_DEV_ERROR_DETECT == STD_ON)
+    if(TaskId >= OS_CONFIGURED_TASKS)
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_CLEAR_EVENT_SID, OS_E_PARAM_TASK);
+        return E_NOT_OK;
+    }
+#endif
+
+    /* The events are set by the tick interrupt, clear them with a read-modify-write it cannot split */
+    interrupt_state = Os_PortDisableInterrupts();
+    Os_TaskEvents[TaskId] &= ~Mask;
+    Os_PortRestoreInterrupts(interrupt_state);
+    return E_OK;
+}
+
+#if (OS_CONFIGURED_TIMERS > 0U)
+/*********************************************************************************************/
+/* Description: Link the timer at the head of a list of the timer wheel */
+STATIC void Os_LinkTimer(Os_TimerType Timer, uint8 List)
+{
+    Os_TimerPrev[Timer] = OS_INVALID_TIMER;
+    Os_TimerNext[Timer] = Os_TimerHead[List];
+    if(Os_TimerHead[List] != OS_INVALID_TIMER)
+    {
+        Os_TimerPrev[Os_TimerHead[List]] = Timer;
+    }
+    Os_TimerHead[List]  = Timer;
+    Os_TimerList[Timer] = List;
+}
+
+/*********************************************************************************************/
+/* Description: Unlink the timer from its list of the timer wheel */
+STATIC void Os_UnlinkTimer(Os_TimerType Timer)
+{
+    if(Os_TimerPrev[Timer] == OS_INVALID_TIMER)
+    {
+        Os_TimerHead[Os_TimerList[Timer]] = Os_TimerNext[Timer];
+    }
+    else
+    {
+        Os_TimerNext[Os_TimerPrev[Timer]] = Os_TimerNext[Timer];
+    }
+    if(Os_TimerNext[Timer] != OS_INVALID_TIMER)
+    {
+        Os_TimerPrev[Os_TimerNext[Timer]] = Os_TimerPrev[Timer];
+    }
+    Os_TimerList[Timer] = OS_TIMER_STOPPED;
+}
+
+/*********************************************************************************************/
+/* Description: Link the timer in the slot of its expiry in the lowest level covering the ticks left */
+STATIC void Os_InsertTimer(Os_TimerType Timer)
+{
+    Os_TimerTickType ticks_left = Os_TimerExpiry[Timer] - Os_TimerTime;
+    uint8 level = 0;
+
+    while((level < (OS_TIMER_WHEEL_LEVELS - 1U)) && ((ticks_left >> (OS_TIMER_WHEEL_BITS * (level + 1U))) != 0))
+    {
+        level++;
+    }
+    Os_LinkTimer(Timer, (uint8)((level * OS_TIMER_WHEEL_SLOTS)
+                                + ((Os_TimerExpiry[Timer] >> (OS_TIMER_WHEEL_BITS * level)) & OS_TIMER_WHEEL_MASK)));
+}
+
+/*********************************************************************************************/
+/* Description: Start the timer Ticks ticks from now, running or not, must be called with the interrupts disabled */
+STATIC void Os_ArmTimer(Os_TimerType Timer, Os_TimerTickType Ticks, Os_TimerTickType Cycle)
+{
+    if(Os_TimerList[Timer] != OS_TIMER_STOPPED)
+    {
+        Os_UnlinkTimer(Timer);
+    }
+    else
+    {
+        Os_TimersRunning++;
+    }
+    Os_TimerTicks[Timer] = Ticks;
+    Os_TimerCycle[Timer] = Cycle;
+
+    /* The next tick processed is the first one of the Ticks */
+    Os_TimerExpiry[Timer] = Os_TimerTime + (Ticks - 1U);
+    Os_InsertTimer(Timer);
+}
+
+/*********************************************************************************************/
+/* Description: Process one Os tick of the timer wheel and run the actions of the expired timers,
+ *              the cyclic ones are inserted again before their action so a callback may stop them.
+ *              Returns the tasks activated by the expired timers */
+STATIC Os_TaskMaskType Os_TimerTick(void)
+{
+    Os_TaskMaskType activated_tasks = 0;
+    Os_TimerType timer;
+    uint8 list = (uint8)(Os_TimerTime & OS_TIMER_WHEEL_MASK);
+    uint8 slot = list;
+    uint8 level;
+
+    /* The wrap of a level moves the timers of the next slot of the level above down to the lower levels */
+    for(level = 1; (slot == 0) && (level < OS_TIMER_WHEEL_LEVELS); level++)
+    {
+        slot = (uint8)((Os_TimerTime >> (OS_TIMER_WHEEL_BITS * level)) & OS_TIMER_WHEEL_MASK);
+        while(Os_TimerHead[(level * OS_TIMER_WHEEL_SLOTS) + slot] != OS_INVALID_TIMER)
+        {
+            timer = Os_TimerHead[(level * OS_TIMER_WHEEL_SLOTS) + slot];
+            Os_UnlinkTimer(timer);
+            Os_InsertTimer(timer);
+        }
+    }
+
+    /* Every timer of the slot expires in this tick, they leave the slot before any action
+     * so a timer restarted by a callback waits for the next round of the slot */
+    while(Os_TimerHead[list] != OS_INVALID_TIMER)
+    {
+        timer = Os_TimerHead[list];
+        Os_UnlinkTimer(timer);
+        Os_LinkTimer(timer, OS_TIMER_EXPIRY_LIST);
+    }
+    Os_TimerTime++;
+
+    while(Os_TimerHead[OS_TIMER_EXPIRY_LIST] != OS_INVALID_TIMER)
+    {
+        timer = Os_TimerHead[OS_TIMER_EXPIRY_LIST];
+        Os_UnlinkTimer(timer);
+
+        if(Os_TimerCycle[timer] != 0)
+        {
+            Os_TimerExpiry[timer] += Os_TimerCycle[timer];
+            Os_InsertTimer(timer);
+        }
+        else
+        {
+            Os_TimersRunning--;
+        }
+
+        switch(Os_Timers[timer].Action)
+        {
+            case OS_ALARM_ACTION_SETEVENT:
+                Os_SetTaskEvent(Os_Timers[timer].Task, Os_Timers[timer].Event);
+                break;
+            case OS_ALARM_ACTION_CALLBACK:
+                Os_Timers[timer].Callback();
+                break;
+            default:
+                activated_tasks |= ((Os_TaskMaskType)1 << Os_Timers[timer].Task);
+                break;
+        }
+    }
+    return activated_tasks;
+}
+#endif
+
+/*********************************************************************************************/
+/* Description: Called by the tick interrupt to advance the timer wheel by the Os ticks elapsed,
+ *              the ticks are only counted while no timer is running.
+ *              Returns the tasks activated by the expired timers */
+STATIC Os_TaskMaskType Os_AdvanceTimers(uint8 Ticks)
+{
+    Os_TaskMaskType activated_tasks = 0;
+
+#if (OS_CONFIGURED_TIMERS > 0U)
+    for(; Ticks > 0; Ticks--)
+    {
+        if(Os_TimersRunning == 0)
+        {
+            Os_TimerTime += Ticks;
+            break;
+        }
+        activated_tasks |= Os_TimerTick();
+    }
+#else
+    Os_TimerTime += Ticks;
+#endif
+    return activated_tasks;
+}
+
+/*********************************************************************************************/
+/* Description: Check the timers configuration and empty the timer wheel */
+STATIC Std_ReturnType Os_InitTimers(const Os_ConfigType * ConfigPtr)
+{
+#if (OS_CONFIGURED_TIMERS > 0U)
+    const Os_TimerConfigType * timer;
+    Os_TimerType timer_id;
+#endif
+    uint8 list;
+
+#if (OS_CONFIGURED_TIMERS > 0U)
+    Os_Timers = ConfigPtr->Timers;
+
+    for(timer_id = 0; timer_id < OS_CONFIGURED_TIMERS; timer_id++)
+    {
+        timer = &Os_Timers[timer_id];
+
+        if(((timer->Action == OS_ALARM_ACTION_CALLBACK) && (timer->Callback == NULL_PTR))
+           || ((timer->Action != OS_ALARM_ACTION_CALLBACK) && (timer->Task >= OS_CONFIGURED_TASKS))
+           || (timer->Action > OS_ALARM_ACTION_CALLBACK))
+        {
+            return E_NOT_OK;
+        }
+        Os_TimerList[timer_id]  = OS_TIMER_STOPPED;
+        Os_TimerTicks[timer_id] = 0;
+    }
+#else
+    (void)ConfigPtr;
+#endif
+
+    for(list = 0; list < OS_TIMER_LISTS; list++)
+    {
+        Os_TimerHead[list] = OS_INVALID_TIMER;
+    }
+    Os_TimerTime     = 0;
+    Os_TimersRunning = 0;
+    return E_OK;
+}
+
+#if (OS_CONFIGURED_TIMERS > 0U)
+/*********************************************************************************************/
+Std_ReturnType Os_StartTimer(Os_TimerType TimerId, Os_TimerTickType Ticks, Os_TimerTickType Cycle)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint32 interrupt_state;
+
+#if (OS_DEV_ERROR_DETECT == STD_ON)
+    if(TimerId >= OS_CONFIGURED_TIMERS)
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_START_TIMER_SID, OS_E_PARAM_TIMER);
+        return E_NOT_OK;
+    }
+    if((Ticks == 0) || (Ticks > OS_TIMER_MAX_TICKS) || (Cycle > OS_TIMER_MAX_TICKS))
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_START_TIMER_SID, OS_E_PARAM_VALUE);
+        return E_NOT_OK;
+    }
+#endif
+
+    interrupt_state = Os_PortDisableInterrupts();
+    if(Os_TimerList[TimerId] == OS_TIMER_STOPPED)
+    {
+        Os_ArmTimer(TimerId, Ticks, Cycle);
+        ret = E_OK;
+    }
+    Os_PortRestoreInterrupts(interrupt_state);
+
+#if (OS_DEV_ERROR_DETECT == STD_ON)
+    if(ret != E_OK)
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_START_TIMER_SID, OS_E_TIMER_STATE);
+    }
+#endif
+    return ret;
+}
+
+/*********************************************************************************************/
+Std_ReturnType Os_StopTimer(Os_TimerType TimerId)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint32 interrupt_state;
+
+#if (OS_DEV_ERROR_DETECT == STD_ON)
+    if(TimerId >= OS_CONFIGURED_TIMERS)
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_STOP_TIMER_SID, OS_E_PARAM_TIMER);
+        return E_NOT_OK;
+    }
+#endif
+
+    interrupt_state = Os_PortDisableInterrupts();
+    if(Os_TimerList[TimerId] != OS_TIMER_STOPPED)
+    {
+        Os_UnlinkTimer(TimerId);
+        Os_TimersRunning--;
+        ret = E_OK;
+    }
+    Os_PortRestoreInterrupts(interrupt_state);
+
+#if (OS_DEV_ERROR_DETECT == STD_ON)
+    if(ret != E_OK)
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_STOP_TIMER_SID, OS_E_TIMER_STATE);
+    }
+#endif
+    return ret;
+}
+
+/*********************************************************************************************/
+Std_ReturnType Os_RestartTimer(Os_TimerType TimerId)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint32 interrupt_state;
+
+#if (OS_DEV_ERROR_DETECT == STD_ON)
+    if(TimerId >= OS_CONFIGURED_TIMERS)
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_RESTART_TIMER_SID, OS_E_PARAM_TIMER);
+        return E_NOT_OK;
+    }
+#endif
+
+    interrupt_state = Os_PortDisableInterrupts();
+    if(Os_TimerTicks[TimerId] != 0)
+    {
+        Os_ArmTimer(TimerId, Os_TimerTicks[TimerId], Os_TimerCycle[TimerId]);
+        ret = E_OK;
+    }
+    Os_PortRestoreInterrupts(interrupt_state);
+
+#if (OS_DEV_ERROR_DETECT == STD_ON)
+    if(ret != E_OK)
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_RESTART_TIMER_SID, OS_E_TIMER_STATE);
+    }
+#endif
+    return ret;
+}
+
+/*********************************************************************************************/
+Std_ReturnType Os_GetTimer(Os_TimerType TimerId, Os_TimerTickType * TicksPtr)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint32 interrupt_state;
+
+#if (OS_DEV_ERROR_DETECT == STD_ON)
+    if(TimerId >= OS_CONFIGURED_TIMERS)
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_GET_TIMER_SID, OS_E_PARAM_TIMER);
+        return E_NOT_OK;
+    }
+    if(NULL_PTR == TicksPtr)
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_GET_TIMER_SID, OS_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+#endif
+
+    /* The expiry tick is counted as it is still to be processed */
+    interrupt_state = Os_PortDisableInterrupts();
+    if(Os_TimerList[TimerId] != OS_TIMER_STOPPED)
+    {
+        *TicksPtr = (Os_TimerExpiry[TimerId] - Os_TimerTime) + 1U;
+        ret = E_OK;
+    }
+    Os_PortRestoreInterrupts(interrupt_state);
+
+#if (OS_DEV_ERROR_DETECT == STD_ON)
+    if(ret != E_OK)
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_GET_TIMER_SID, OS_E_TIMER_STATE);
+    }
+#endif
+    return ret;
+}
+#endif
+
+/*********************************************************************************************/
+void Os_CoroutineStartDelay(Os_CoroutineType * Coroutine, Os_TimerTickType Ticks)
+{
+    uint32 interrupt_state;
+
+#if (OS_DEV_ERROR_DETECT == STD_ON)
+    if(NULL_PTR == Coroutine)
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_COROUTINE_START_DELAY_SID, OS_E_PARAM_POINTER);
+        return;
+    }
+#if (OS_CONFIGURED_TIMERS > 0U)
+    if((Coroutine->Timer != OS_COROUTINE_NO_TIMER) && (Coroutine->Timer >= OS_CONFIGURED_TIMERS))
+#else
+    if(Coroutine->Timer != OS_COROUTINE_NO_TIMER)
+#endif
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_COROUTINE_START_DELAY_SID, OS_E_PARAM_TIMER);
+        return;
+    }
+    if((Ticks == 0) || (Ticks > OS_TIMER_MAX_TICKS))
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_COROUTINE_START_DELAY_SID, OS_E_PARAM_VALUE);
+        return;
+    }
+#endif
+
+    /* The timer expires in the tick which makes the Os tick count reach the wake tick */
+    interrupt_state = Os_PortDisableInterrupts();
+    Coroutine->Wake_Tick = Os_TickCount + Ticks;
+#if (OS_CONFIGURED_TIMERS > 0U)
+    if(Coroutine->Timer != OS_COROUTINE_NO_TIMER)
+    {
+        Os_ArmTimer(Coroutine->Timer, Ticks, 0);
+    }
+#endif
+    Os_PortRestoreInterrupts(interrupt_state);
+}
+
+/*********************************************************************************************/
+boolean Os_CoroutineDelayElapsed(const Os_CoroutineType * Coroutine)
+{
+    return (Os_GetTickCount() >= Coroutine->Wake_Tick) ? TRUE : FALSE;
+}
+
+/*********************************************************************************************/
+boolean Os_CoroutineEventSet(const Os_CoroutineType * Coroutine, Os_EventMaskType Mask)
+{
+    return ((Os_TaskEvents[Coroutine->Task] & Mask) != 0) ? TRUE : FALSE;
+}
+
+#if (OS_TICKLESS_IDLE == STD_ON)
+/*********************************************************************************************/
+/* Description: Os ticks from the start of the SysTick period in progress to the next tick having work
+ *              in the timer wheel: a timer expiry or a slot of an upper level to move down */
+STATIC uint32 Os_GetTicksToNextTimer(void)
+{
+    Os_TimerTickType time = Os_TimerTime;
+    uint32 ticks;
+    uint8 level;
+    uint8 slot;
+
+    if(Os_TimersRunning == 0)
+    {
+        return OS_TICKLESS_MAX_TICKS;
+    }
+
+    for(ticks = 1; ticks < OS_TICKLESS_MAX_TICKS; ticks++)
+    {
+        slot = (uint8)(time & OS_TIMER_WHEEL_MASK);
+        if(Os_TimerHead[slot] != OS_INVALID_TIMER)
+        {
+            return ticks;
+        }
+        for(level = 1; (slot == 0) && (level < OS_TIMER_WHEEL_LEVELS); level++)
+        {
+            slot = (uint8)((time >> (OS_TIMER_WHEEL_BITS * level)) & OS_TIMER_WHEEL_MASK);
+            if(Os_TimerHead[(level * OS_TIMER_WHEEL_SLOTS) + slot] != OS_INVALID_TIMER)
+            {
+                return ticks;
+            }
+        }
+        time++;
+    }
+    return OS_TICKLESS_MAX_TICKS;
+}
+
+/*********************************************************************************************/
+/* Description: Os ticks from the start of the SysTick period in progress to the next alarm expiry,
+ *              expiries further than OS_TICKLESS_MAX_TICKS are not needed by the idle loop */
+STATIC uint32 Os_GetTicksToNextAlarm(void)
+{
+    uint32 next_ticks = OS_TICKLESS_MAX_TICKS;
+#if (OS_ALARM_LIST_ENTRIES > 0U)
+    uint32 ticks;
+    Os_CounterType counter;
+    Os_AlarmType head;
+
+    for(counter = 0; counter < OS_CONFIGURED_COUNTERS; counter++)
+    {
+        head = Os_CounterHead[counter];
+        if((head != OS_INVALID_ALARM) && (Os_AlarmDelta[head] <= OS_TICKLESS_MAX_TICKS))
+        {
+            ticks = ((Os_AlarmDelta[head] - 1U) * Os_Counters[counter].Ticks_Per_Base)
+                    + (Os_Counters[counter].Ticks_Per_Base - Os_CounterPrescale[counter]);
+            if(ticks < next_ticks)
+            {
+                next_ticks = ticks;
+            }
+        }
+    }
+#endif
+    return next_ticks;
+}
+#endif
+
+#if (OS_TASK_PROFILING == STD_ON)
+/*********************************************************************************************/
+/* Description: Start measuring a new activation of the task */
+STATIC void Os_ProfileTaskStart(Os_TaskType Task)
+{
+    Os_TaskExec_Cycles[Task] = 0;
+    Os_TaskExec_Start[Task]  = DWT_CYCCNT_REG;
+}
+
+/*********************************************************************************************/
+/* Description: Account the execution of the task which just completed */
+STATIC void Os_ProfileTaskEnd(Os_TaskType Task)
+{
+    uint32 cycles = Os_TaskExec_Cycles[Task] + (DWT_CYCCNT_REG - Os_TaskExec_Start[Task]);
+    uint32 bucket = cycles / OS_PROFILING_BUCKET_CYCLES;
+    Os_TaskProfileType * profile = &Os_TaskProfile[Task];
+
+    if((profile->Activations == 0) || (cycles < profile->Min_Cycles))
+    {
+        profile->Min_Cycles = cycles;
+    }
+    if(cycles > profile->Max_Cycles)
+    {
+        profile->Max_Cycles = cycles;
+    }
+    if(bucket >= OS_PROFILING_HISTOGRAM_BUCKETS)
+    {
+        bucket = OS_PROFILING_HISTOGRAM_BUCKETS - 1U;
+    }
+    profile->Histogram[bucket]++;
+    profile->Total_Cycles += cycles;
+    profile->Activations++;
+}
+
+/*********************************************************************************************/
+Std_ReturnType Os_GetTaskProfile(Os_TaskType TaskId, Os_TaskProfileType * ProfilePtr)
+{
+    uint8 bucket;
+    uint32 interrupt_state;
+
+#if (OS_DEV_ERROR_DETECT == STD_ON)
+    if(TaskId >= OS_CONFIGURED_TASKS)
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_GET_TASK_PROFILE_SID, OS_E_PARAM_TASK);
+        return E_NOT_OK;
+    }
+    if(NULL_PTR == ProfilePtr)
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_GET_TASK_PROFILE_SID, OS_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+#endif
+
+    /* Take a consistent copy, the statistics are updated by the tasks */
+    interrupt_state = Os_PortDisableInterrupts();
+    ProfilePtr->Activations  = Os_TaskProfile[TaskId].Activations;
+    ProfilePtr->Min_Cycles   = Os_TaskProfile[TaskId].Min_Cycles;
+    ProfilePtr->Max_Cycles   = Os_TaskProfile[TaskId].Max_Cycles;
+    ProfilePtr->Total_Cycles = Os_TaskProfile[TaskId].Total_Cycles;
+    for(bucket = 0; bucket < OS_PROFILING_HISTOGRAM_BUCKETS; bucket++)
+    {
+        ProfilePtr->Histogram[bucket] = Os_TaskProfile[TaskId].Histogram[bucket];
+    }
+    Os_PortRestoreInterrupts(interrupt_state);
+
+    if(ProfilePtr->Activations != 0)
+    {
+        ProfilePtr->Average_Cycles = (uint32)(ProfilePtr->Total_Cycles / ProfilePtr->Activations);
+    }
+    else
+    {
+        ProfilePtr->Average_Cycles = 0;
+    }
+    return E_OK;
+}
+#endif /* (OS_TASK_PROFILING == STD_ON) */
+
+#if (OS_CPU_LOAD_MEASUREMENT == STD_ON)
+/*********************************************************************************************/
+/* Description: The CPU enters the idle loop */
+STATIC void Os_LoadIdleEnter(void)
+{
+    uint32 interrupt_state = Os_PortDisableInterrupts();
+
+    if(!Os_CpuIdle)
+    {
+        Os_IdleStart = DWT_CYCCNT_REG;
+        Os_CpuIdle   = TRUE;
+    }
+    Os_PortRestoreInterrupts(interrupt_state);
+}
+
+/*********************************************************************************************/
+/* Description: The CPU leaves the idle loop to run a task */
+STATIC void Os_LoadIdleExit(void)
+{
+    uint32 interrupt_state = Os_PortDisableInterrupts();
+
+    if(Os_CpuIdle)
+    {
+        Os_IdleCycles += DWT_CYCCNT_REG - Os_IdleStart;
+        Os_CpuIdle     = FALSE;
+    }
+    Os_PortRestoreInterrupts(interrupt_state);
+}
+
+/*********************************************************************************************/
+/* Description: Called by the tick interrupt, computes the load at the end of every hyperperiod.
+ *              The busy cycles are measured but the window length comes from the Os ticks
+ *              as the cycle counter does not count while the CPU sleeps */
+STATIC void Os_LoadTick(uint8 Ticks)
+{
+    uint32 now;
+    uint32 busy_cycles;
+    uint32 window_cycles;
+    uint16 load;
+
+    Os_LoadWindowTicks += Ticks;
+    if(Os_LoadWindowTicks < Os_HyperPeriod_Ticks)
+    {
+        return;
+    }
+
+    now = DWT_CYCCNT_REG;
+    if(Os_CpuIdle)
+    {
+        Os_IdleCycles += now - Os_IdleStart;
+        Os_IdleStart   = now;
+    }
+    busy_cycles   = (now - Os_LoadWindowStart) - Os_IdleCycles;
+    /* The length of a window is taken from the Os ticks at the system clock of the Mcu Driver,
+     * the cycle counter stops while the CPU sleeps in the tickless idle */
+    window_cycles = (uint32)Os_LoadWindowTicks * OS_BASE_TIME * (Mcu_GetClockFrequency() / 1000UL);
+
+    if(busy_cycles >= window_cycles)
+    {
+        load = OS_CPU_LOAD_FULL;
+    }
+    else
+    {
+        load = (uint16)(((uint64)busy_cycles * OS_CPU_LOAD_FULL) / window_cycles);
+    }
+
+    Os_LoadWindowStart = now;
+    Os_LoadWindowTicks = 0;
+    Os_IdleCycles      = 0;
+
+    /* The average starts from the first load then moves by 1/2^OS_CPU_LOAD_AVERAGE_SHIFT of the difference */
+    if(Os_CpuLoad.Windows == 0)
+    {
+        Os_LoadAverage_Scaled = (uint32)load << OS_CPU_LOAD_AVERAGE_SHIFT;
+    }
+    else
+    {
+        Os_LoadAverage_Scaled = (Os_LoadAverage_Scaled - (Os_LoadAverage_Scaled >> OS_CPU_LOAD_AVERAGE_SHIFT)) + load;
+    }
+
+    Os_CpuLoad.Current = load;
+    Os_CpuLoad.Average = (uint16)(Os_LoadAverage_Scaled >> OS_CPU_LOAD_AVERAGE_SHIFT);
+    if(load > Os_CpuLoad.Peak)
+    {
+        Os_CpuLoad.Peak = load;
+    }
+    Os_CpuLoad.Windows++;
+}
+
+/*********************************************************************************************/
+Std_ReturnType Os_GetCpuLoad(Os_CpuLoadType * LoadPtr)
+{
+    uint32 interrupt_state;
+
+#if (OS_DEV_ERROR_DETECT == STD_ON)
+    if(NULL_PTR == LoadPtr)
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_GET_CPU_LOAD_SID, OS_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+#endif
+
+    /* Take a consistent copy, the loads are updated by the tick interrupt */
+    interrupt_state = Os_PortDisableInterrupts();
+    LoadPtr->Current = Os_CpuLoad.Current;
+    LoadPtr->Peak    = Os_CpuLoad.Peak;
+    LoadPtr->Average = Os_CpuLoad.Average;
+    LoadPtr->Windows = Os_CpuLoad.Windows;
+    Os_PortRestoreInterrupts(interrupt_state);
+    return E_OK;
+}
+
+/*********************************************************************************************/
+void Os_ResetCpuLoadPeak(void)
+{
+    uint32 interrupt_state;
+
+    interrupt_state = Os_PortDisableInterrupts();
+    Os_CpuLoad.Peak = Os_CpuLoad.Current;
+    Os_PortRestoreInterrupts(interrupt_state);
+}
+#endif /* (OS_CPU_LOAD_MEASUREMENT == STD_ON) */
+
+#if (OS_TRACE == STD_ON)
+/*********************************************************************************************/
+void Os_TraceRecord(uint8 Type, uint8 Id, uint16 Data)
+{
+    volatile Os_TraceRecordType * record;
+    uint32 interrupt_state;
+
+    if(Os_TraceRunning)
+    {
+        /* Reserve the slot and fill it before an interrupt adds its own record */
+        interrupt_state = Os_PortDisableInterrupts();
+        record = &Os_Trace.Records[Os_Trace.Count & (OS_TRACE_BUFFER_SIZE - 1U)];
+        record->Timestamp = DWT_CYCCNT_REG;
+        record->Type = Type;
+        record->Id   = Id;
+        record->Data = Data;
+        Os_Trace.Count++;
+        Os_PortRestoreInterrupts(interrupt_state);
+    }
+}
+
+/*********************************************************************************************/
+void Os_TraceStop(void)
+{
+    Os_TraceRunning = FALSE;
+}
+
+/*********************************************************************************************/
+void Os_TraceStart(void)
+{
+    Os_TraceRunning = TRUE;
+}
+#endif /* (OS_TRACE == STD_ON) */
+
+#if (OS_STACK_MONITORING == STD_ON)
+/*********************************************************************************************/
+/* Description: Register a stack and paint its Painted lowest words */
+STATIC void Os_PaintStack(Os_StackType Stack, uint32 * Base, uint16 Size, uint16 Painted)
+{
+    uint16 word;
+
+    for(word = 0; word < Painted; word++)
+    {
+        Base[word] = OS_STACK_PATTERN;
+    }
+    Os_StackBase[Stack]       = Base;
+    Os_StackSize[Stack]       = Size;
+    Os_StackFree[Stack]       = Painted;
+    Os_StackOverflowed[Stack] = FALSE;
+}
+
+/*********************************************************************************************/
+/* Description: Paint the stacks before they are used, the main stack only under the stack pointer */
+STATIC void Os_InitStacks(void)
+{
+    uint32 stack_marker;
+    uint32 * main_limit = &stack_marker - OS_STACK_PAINT_MARGIN;
+    Os_StackType stack;
+
+    for(stack = 0; stack < OS_MONITORED_STACKS; stack++)
+    {
+        Os_StackBase[stack] = NULL_PTR;
+    }
+
+#if (OS_PREEMPTIVE_MODE == STD_ON)
+    for(stack = 0; stack < OS_CONFIGURED_TASKS; stack++)
+    {
+        Os_PaintStack(stack, Os_Tasks[stack].Stack_Ptr, Os_Tasks[stack].Stack_Size, Os_Tasks[stack].Stack_Size);
+    }
+    Os_PaintStack(OS_STACK_ISR, Os_IsrStack, OS_ISR_STACK_SIZE, OS_ISR_STACK_SIZE);
+#endif
+
+    /* The guard words of the main stack must be free when Os_start runs, otherwise it is not monitored */
+    if(main_limit >= (&__stack + OS_STACK_GUARD_WORDS))
+    {
+        Os_PaintStack(OS_STACK_MAIN, &__stack, (uint16)(&__STACK_END - &__stack), (uint16)(main_limit - &__stack));
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Called by the tick interrupt to check the guard words at the bottom of every stack */
+STATIC void Os_CheckStackGuards(void)
+{
+    Os_StackType stack;
+    uint16 word;
+
+    for(stack = 0; stack < OS_MONITORED_STACKS; stack++)
+    {
+        if((Os_StackBase[stack] == NULL_PTR) || (Os_StackOverflowed[stack]))
+        {
+            continue;
+        }
+        for(word = 0; word < OS_STACK_GUARD_WORDS; word++)
+        {
+            if(Os_StackBase[stack][word] != OS_STACK_PATTERN)
+            {
+                Os_StackOverflowed[stack] = TRUE;
+                Os_StackFree[stack] = 0;
+                Os_StackOverflowHook(stack);
+                break;
+            }
+        }
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Called by the idle loop to continue the high-water scan: the painted words of every
+ *              stack are checked from the bottom, OS_STACK_SCAN_WORDS at a time, up to the first used one */
+STATIC void Os_ScanStacks(void)
+{
+    uint16 words;
+    uint16 free_words;
+    uint32 interrupt_state;
+
+    for(words = 0; words < OS_STACK_SCAN_WORDS; words++)
+    {
+        free_words = Os_StackFree[Os_StackScan_Stack];
+
+        if((Os_StackBase[Os_StackScan_Stack] == NULL_PTR) || (Os_StackScan_Word >= free_words))
+        {
+            /* Stack done, the next one is scanned from its bottom */
+            Os_StackScan_Word  = 0;
+            Os_StackScan_Stack = (Os_StackType)((Os_StackScan_Stack + 1U) % OS_MONITORED_STACKS);
+        }
+        else if(Os_StackBase[Os_StackScan_Stack][Os_StackScan_Word] != OS_STACK_PATTERN)
+        {
+            /* The tick may have reported an overflow meanwhile, the mark only moves down */
+            interrupt_state = Os_PortDisableInterrupts();
+            if(Os_StackScan_Word < Os_StackFree[Os_StackScan_Stack])
+            {
+                Os_StackFree[Os_StackScan_Stack] = Os_StackScan_Word;
+            }
+            Os_PortRestoreInterrupts(interrupt_state);
+        }
+        else
+        {
+            Os_StackScan_Word++;
+        }
+    }
+}
+
+/*********************************************************************************************/
+Std_ReturnType Os_GetStackUsage(Os_StackType StackId, Os_StackUsageType * UsagePtr)
+{
+#if (OS_DEV_ERROR_DETECT == STD_ON)
+    if((StackId >= OS_MONITORED_STACKS) || (Os_StackBase[StackId] == NULL_PTR))
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_GET_STACK_USAGE_SID, OS_E_PARAM_STACK);
+        return E_NOT_OK;
+    }
+    if(NULL_PTR == UsagePtr)
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_GET_STACK_USAGE_SID, OS_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+#else
+    if((StackId >= OS_MONITORED_STACKS) || (Os_StackBase[StackId] == NULL_PTR))
+    {
+        return E_NOT_OK;
+    }
+#endif
+
+    UsagePtr->Size     = Os_StackSize[StackId];
+    UsagePtr->Max_Used = Os_StackSize[StackId] - Os_StackFree[StackId];
+    return E_OK;
+}
+#endif /* (OS_STACK_MONITORING == STD_ON) */
+
+#if (OS_PREEMPTIVE_MODE == STD_OFF)
+/*********************************************************************************************/
+/* Description: Queue activated tasks, an activation of a task already queued is lost.
+ *              Returns the tasks which lost their activation */
+STATIC Os_TaskMaskType Os_QueueActivations(Os_TaskMaskType Tasks)
+{
+    Os_TaskMaskType lost_tasks;
+    uint32 interrupt_state;
+
+    interrupt_state = Os_PortDisableInterrupts();
+    lost_tasks = Os_ActivatedTasks & Tasks;
+    Os_ActivatedTasks |= Tasks;
+    Os_PortRestoreInterrupts(interrupt_state);
+
+    if(lost_tasks != 0)
+    {
+        Os_ReportOverrun(lost_tasks, OS_OVERRUN_ACTIVATION_LOST);
+    }
+    return lost_tasks;
+}
+
+/*********************************************************************************************/
+/* Description: Set events of a task and queue it so it runs to handle them, a task already
+ *              queued handles the new events in the same run */
+STATIC void Os_SetTaskEvent(Os_TaskType Task, Os_EventMaskType Mask)
+{
+    uint32 interrupt_state;
+
+    interrupt_state = Os_PortDisableInterrupts();
+    Os_TaskEvents[Task] |= Mask;
+    Os_ActivatedTasks   |= ((Os_TaskMaskType)1 << Task);
+    Os_PortRestoreInterrupts(interrupt_state);
+}
+
+/*********************************************************************************************/
+/* Description: Run a set of tasks in Task Id order, a task still running when a new tick
+ *              arrives made its slot longer than OS_BASE_TIME */
+STATIC void Os_RunTasks(Os_TaskMaskType Tasks)
+{
+    Os_TaskType task;
+    uint8 ticks_received;
+    uint8 resource_top = Os_ResourceTop;
+
+    if(Tasks != 0)
+    {
+        OS_LOAD_IDLE_EXIT();
+    }
+
+    for(task = 0; Tasks != 0; task++, Tasks >>= 1)
+    {
+        if(Tasks & 1U)
+        {
+            ticks_received = g_Ticks_Received;
+
+            OS_TRACE_RECORD(OS_TRACE_TYPE_TASK_START, task, 0);
+            OS_PROFILE_TASK_START(task);
+            Os_Tasks[task].Task_Ptr();
+            OS_PROFILE_TASK_END(task);
+            OS_TRACE_RECORD(OS_TRACE_TYPE_TASK_END, task, 0);
+
+            Os_ReleaseTaskResources(resource_top);
+
+            if(ticks_received != g_Ticks_Received)
+            {
+                Os_ReportOverrun((Os_TaskMaskType)1 << task, OS_OVERRUN_DEADLINE);
+            }
+        }
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Move the scheduler to the next slot of the schedule table, the table restarts every hyperperiod */
+STATIC void Os_NextSlot(void)
+{
+    g_Time_Tick_Count++;
+    if(g_Time_Tick_Count >= Os_HyperPeriod_Ticks)
+    {
+        g_Time_Tick_Count = 0;
+    }
+    g_Ticks_Processed++;
+}
+#endif
+
+#if (OS_PREEMPTIVE_MODE == STD_ON)
+/*********************************************************************************************/
+/* Description: Entry point of every task in preemptive mode, it runs the task function
+ *              and terminates the task once the function returns */
+STATIC void Os_TaskEntry(Os_TaskType Task)
+{
+    /* The resources taken from now on belong to this task, the ones below were taken by the
+     * tasks it preempted. Recorded here and not at activation: the preempted task may release
+     * resources between the activation and the first run */
+    Os_Tcb[Task].Resource_Top = Os_ResourceTop;
+
+    OS_TRACE_RECORD(OS_TRACE_TYPE_TASK_START, Task, 0);
+    OS_PROFILE_TASK_START(Task);
+    Os_Tasks[Task].Task_Ptr();
+    OS_PROFILE_TASK_END(Task);
+    OS_TRACE_RECORD(OS_TRACE_TYPE_TASK_END, Task, 0);
+
+    Os_ReleaseTaskResources(Os_Tcb[Task].Resource_Top);
+
+    /* Terminate the task and switch to the next ready task, its context is not used any more once
+     * the switch is done. Until then an activation must not prepare a new context on its stack */
+    Disable_Exceptions();
+    Os_Tcb[Task].State = OS_TASK_TERMINATING;
+    NVIC_SYSTEM_INTCTRL = OS_PENDSV_SET_MASK;
+    Enable_Exceptions();
+
+    while(1)
+    {
+        /* Never reached ... the PendSV handler switches to another task */
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Prepare the stack of a task as if it was preempted just before Os_TaskEntry,
+ *              so the PendSV handler starts it like any other preempted task */
+STATIC uint32 * Os_InitTaskStack(Os_TaskType Task)
+{
+    uint32 * sp = Os_Tasks[Task].Stack_Ptr + Os_Tasks[Task].Stack_Size;
+    uint8 reg;
+
+    /* The exception frame must be 8-byte aligned */
+    sp = (uint32 *)((uint32)sp & ~(uint32)0x07);
+
+    /* Frame unstacked by the hardware on exception return */
+    *(--sp) = OS_INITIAL_XPSR;                                   /* xPSR */
+    *(--sp) = (uint32)Os_TaskEntry & ~(uint32)0x01;              /* PC */
+    *(--sp) = 0;                                                 /* LR */
+    *(--sp) = 0;                                                 /* R12 */
+    *(--sp) = 0;                                                 /* R3 */
+    *(--sp) = 0;                                                 /* R2 */
+    *(--sp) = 0;                                                 /* R1 */
+    *(--sp) = (uint32)Task;                                      /* R0 --> Os_TaskEntry argument */
+
+    /* Frame restored by the PendSV handler */
+    *(--sp) = OS_INITIAL_EXC_RETURN;                             /* LR (EXC_RETURN) */
+    for(reg = 0; reg < 8; reg++)
+    {
+        *(--sp) = 0;                                             /* R11 .. R4 */
+    }
+    return sp;
+}
+
+/*********************************************************************************************/
+/* Description: Return the highest priority task which is ready or running (the idle loop at least) */
+STATIC Os_TaskType Os_GetHighestReadyTask(void)
+{
+    Os_TaskType highest = OS_IDLE_TASK;
+    Os_TaskType task;
+
+    for(task = 0; task < OS_CONFIGURED_TASKS; task++)
+    {
+        if(((Os_Tcb[task].State == OS_TASK_READY) || (Os_Tcb[task].State == OS_TASK_RUNNING))
+           && (Os_Tcb[task].Priority > Os_Tcb[highest].Priority))
+        {
+            highest = task;
+        }
+    }
+    return highest;
+}
+
+/*********************************************************************************************/
+/* Description: Make the due tasks ready and request a context switch if one of them
+ *              has a higher priority than the running task. Returns the tasks which lost
+ *              their activation */
+STATIC Os_TaskMaskType Os_ActivateTasks(Os_TaskMaskType Tasks)
+{
+    Os_TaskType task;
+    uint32 interrupt_state;
 
-/* Enable Faults ... This Macro enable Faults by clearing the F-bit in the FAULTMASK */
-#define Enable_Faults()        __asm(" CPSIE F ")
+    Os_TaskMaskType lost_tasks = 0;
 
-/* Disable Faults ... This Macro disable Faults by setting the F-bit in the FAULTMASK */
-#define Disable_Faults()       __asm(" CPSID F ")
+    /* The tasks may be activated by the tick and by other interrupts */
+    interrupt_state = Os_PortDisableInterrupts();
+    for(task = 0; task < OS_CONFIGURED_TASKS; task++)
+    {
+        if((Tasks >> task) & 1U)
+        {
+            if(Os_Tcb[task].State == OS_TASK_SUSPENDED)
+            {
+                Os_Tcb[task].Stack_Ptr = Os_InitTaskStack(task);
+                Os_Tcb[task].State     = OS_TASK_READY;
+            }
+            else if(Os_Tcb[task].State == OS_TASK_TERMINATING)
+            {
+                /* Its stack is still in use, the PendSV handler prepares the new context */
+                Os_Tcb[task].State = OS_TASK_RESTARTING;
+            }
+            else
+            {
+                /* The task is still active from its previous activation, this one is lost */
+                lost_tasks |= ((Os_TaskMaskType)1 << task);
+            }
+        }
+    }
+
+    if(Os_GetHighestReadyTask() != Os_CurrentTask)
+    {
+        NVIC_SYSTEM_INTCTRL = OS_PENDSV_SET_MASK;
+    }
+    Os_PortRestoreInterrupts(interrupt_state);
+
+    if(lost_tasks != 0)
+    {
+        Os_ReportOverrun(lost_tasks, OS_OVERRUN_ACTIVATION_LOST);
+    }
+    return lost_tasks;
+}
+
+/*********************************************************************************************/
+/* Description: Set events of a task, a suspended task is activated to handle them and a task
+ *              waiting for one of them becomes ready */
+STATIC void Os_SetTaskEvent(Os_TaskType Task, Os_EventMaskType Mask)
+{
+    uint32 interrupt_state;
+
+    interrupt_state = Os_PortDisableInterrupts();
+    Os_TaskEvents[Task] |= Mask;
+    if(Os_Tcb[Task].State == OS_TASK_SUSPENDED)
+    {
+        Os_Tcb[Task].Stack_Ptr = Os_InitTaskStack(Task);
+        Os_Tcb[Task].State     = OS_TASK_READY;
+    }
+    else if(Os_Tcb[Task].State == OS_TASK_TERMINATING)
+    {
+        /* Its stack is still in use, the PendSV handler prepares the new context */
+        Os_Tcb[Task].State = OS_TASK_RESTARTING;
+    }
+    else if((Os_Tcb[Task].State == OS_TASK_WAITING) && ((Os_TaskEvents[Task] & Os_Tcb[Task].Wait_Mask) != 0))
+    {
+        Os_Tcb[Task].State = OS_TASK_READY;
+    }
+    else
+    {
+        /* The task is ready or running, it sees the new events */
+    }
+
+    if(Os_GetHighestReadyTask() != Os_CurrentTask)
+    {
+        NVIC_SYSTEM_INTCTRL = OS_PENDSV_SET_MASK;
+    }
+    Os_PortRestoreInterrupts(interrupt_state);
+}
+
+/*********************************************************************************************/
+Std_ReturnType Os_WaitEvent(Os_EventMaskType Mask)
+{
+#if (OS_DEV_ERROR_DETECT == STD_ON)
+    /* Only a task has its own context to wait in, not the idle loop nor an interrupt */
+    if((Os_CurrentTask == OS_IDLE_TASK) || (Os_PortGetIpsr() != 0))
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_WAIT_EVENT_SID, OS_E_CALL_LEVEL);
+        return E_NOT_OK;
+    }
+    /* A task waiting with a resource would block the other users of the resource */
+    if(Os_ResourceTop != Os_Tcb[Os_CurrentTask].Resource_Top)
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_WAIT_EVENT_SID, OS_E_RESOURCE_STATE);
+        return E_NOT_OK;
+    }
+#endif
+
+    Disable_Exceptions();
+    if((Os_TaskEvents[Os_CurrentTask] & Mask) == 0)
+    {
+        /* Leave the CPU, the PendSV handler runs as soon as the interrupts are enabled
+         * and the task continues here once Os_SetEvent made it ready again */
+        Os_Tcb[Os_CurrentTask].Wait_Mask = Mask;
+        Os_Tcb[Os_CurrentTask].State     = OS_TASK_WAITING;
+        NVIC_SYSTEM_INTCTRL = OS_PENDSV_SET_MASK;
+    }
+    Enable_Exceptions();
+    return E_OK;
+}
+#endif /* (OS_PREEMPTIVE_MODE == STD_ON) */
+
+/*********************************************************************************************/
+/* Description: Check the resources configuration */
+STATIC Std_ReturnType Os_InitResources(const Os_ConfigType * ConfigPtr)
+{
+#if (OS_CONFIGURED_RESOURCES > 0U)
+    Os_ResourceType resource;
+
+    Os_Resources = ConfigPtr->Resources;
+
+    for(resource = 0; resource < OS_CONFIGURED_RESOURCES; resource++)
+    {
+        if(Os_Resources[resource].Isr_Ceiling >= OS_NVIC_PRIORITY_LEVELS)
+        {
+            return E_NOT_OK;
+        }
+        Os_ResourceTaken[resource] = FALSE;
+    }
+#else
+    (void)ConfigPtr;
+#endif
+    Os_ResourceTop = 0;
+    return E_OK;
+}
+
+#if (OS_CONFIGURED_RESOURCES > 0U)
+/*********************************************************************************************/
+/* Description: Release the last resource taken, must be called with the interrupts disabled */
+STATIC void Os_PopResource(void)
+{
+    Os_ResourceType resource = Os_ResourceStack[--Os_ResourceTop];
+
+    Os_ResourceTaken[resource] = FALSE;
+#if (OS_PREEMPTIVE_MODE == STD_ON)
+    if(Os_PortGetIpsr() == 0)
+    {
+        /* Back to the priority before the resource, a task made ready meanwhile may run now */
+        Os_Tcb[Os_CurrentTask].Priority = Os_ResourcePriority[resource];
+        if(Os_GetHighestReadyTask() != Os_CurrentTask)
+        {
+            NVIC_SYSTEM_INTCTRL = OS_PENDSV_SET_MASK;
+        }
+    }
+#endif
+    Os_PortSetBasePri(Os_ResourceBasePri[resource]);
+}
+#endif
+
+/*********************************************************************************************/
+/* Description: Called when a task ends, releases the resources it took and did not release */
+STATIC void Os_ReleaseTaskResources(uint8 Resource_Top)
+{
+#if (OS_CONFIGURED_RESOURCES > 0U)
+    uint32 interrupt_state;
+
+    if(Os_ResourceTop == Resource_Top)
+    {
+        return;
+    }
+
+    interrupt_state = Os_PortDisableInterrupts();
+    while(Os_ResourceTop > Resource_Top)
+    {
+        Os_PopResource();
+    }
+    Os_PortRestoreInterrupts(interrupt_state);
+
+#if (OS_DEV_ERROR_DETECT == STD_ON)
+    Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_RELEASE_RESOURCE_SID, OS_E_RESOURCE_STATE);
+#endif
+#else
+    /* Without resources none can be left taken */
+    (void)Resource_Top;
+#endif
+}
+
+#if (OS_CONFIGURED_RESOURCES > 0U)
+/*********************************************************************************************/
+Std_ReturnType Os_GetResource(Os_ResourceType ResId)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint32 interrupt_state;
+#if (OS_PREEMPTIVE_MODE == STD_ON)
+    uint16 ceiling;
+#endif
+
+#if (OS_DEV_ERROR_DETECT == STD_ON)
+    if(ResId >= OS_CONFIGURED_RESOURCES)
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_GET_RESOURCE_SID, OS_E_PARAM_RESOURCE);
+        return E_NOT_OK;
+    }
+#endif
+
+    interrupt_state = Os_PortDisableInterrupts();
+    if(!Os_ResourceTaken[ResId])
+    {
+        Os_ResourceTaken[ResId] = TRUE;
+        Os_ResourceStack[Os_ResourceTop++] = ResId;
+
+        /* Mask the interrupts using the resource, a ceiling of 0 keeps the current mask */
+        Os_ResourceBasePri[ResId] = Os_PortRaiseBasePri((uint32)Os_Resources[ResId].Isr_Ceiling << (8U - OS_NVIC_PRIORITY_BITS));
+
+#if (OS_PREEMPTIVE_MODE == STD_ON)
+        /* The task runs at the ceiling so the tasks using the resource cannot preempt it */
+        if(Os_PortGetIpsr() == 0)
+        {
+            Os_ResourcePriority[ResId] = Os_Tcb[Os_CurrentTask].Priority;
+            ceiling = OS_CEILING_PRIORITY(Os_Resources[ResId].Task_Ceiling);
+            if(ceiling > Os_Tcb[Os_CurrentTask].Priority)
+            {
+                Os_Tcb[Os_CurrentTask].Priority = ceiling;
+            }
+        }
+#endif
+        ret = E_OK;
+    }
+    Os_PortRestoreInterrupts(interrupt_state);
+
+#if (OS_DEV_ERROR_DETECT == STD_ON)
+    if(ret != E_OK)
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_GET_RESOURCE_SID, OS_E_RESOURCE_STATE);
+    }
+#endif
+    return ret;
+}
+
+/*********************************************************************************************/
+Std_ReturnType Os_ReleaseResource(Os_ResourceType ResId)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint32 interrupt_state;
+
+#if (OS_DEV_ERROR_DETECT == STD_ON)
+    if(ResId >= OS_CONFIGURED_RESOURCES)
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_RELEASE_RESOURCE_SID, OS_E_PARAM_RESOURCE);
+        return E_NOT_OK;
+    }
+#endif
+
+    /* Only the last resource taken can be released */
+    interrupt_state = Os_PortDisableInterrupts();
+    if((Os_ResourceTop != 0) && (Os_ResourceStack[Os_ResourceTop - 1U] == ResId))
+    {
+        Os_PopResource();
+        ret = E_OK;
+    }
+    Os_PortRestoreInterrupts(interrupt_state);
+
+#if (OS_DEV_ERROR_DETECT == STD_ON)
+    if(ret != E_OK)
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_RELEASE_RESOURCE_SID, OS_E_RESOURCE_STATE);
+    }
+#endif
+    return ret;
+}
+#endif
+
+/*********************************************************************************************/
+Std_ReturnType Os_ActivateTask(Os_TaskType TaskId)
+{
+    Os_TaskMaskType lost_tasks;
+
+#if (OS_DEV_ERROR_DETECT == STD_ON)
+    if(TaskId >= OS_CONFIGURED_TASKS)
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_ACTIVATE_TASK_SID, OS_E_PARAM_TASK);
+        return E_NOT_OK;
+    }
+#endif
+
+#if (OS_PREEMPTIVE_MODE == STD_ON)
+    lost_tasks = Os_ActivateTasks((Os_TaskMaskType)1 << TaskId);
+#else
+    lost_tasks = Os_QueueActivations((Os_TaskMaskType)1 << TaskId);
+#endif
+
+    return (lost_tasks == 0) ? E_OK : E_NOT_OK;
+}
+
+/*********************************************************************************************/
+Std_ReturnType Os_SetEvent(Os_TaskType TaskId, Os_EventMaskType Mask)
+{
+#if (OS_DEV_ERROR_DETECT == STD_ON)
+    if(TaskId >= OS_CONFIGURED_TASKS)
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_SET_EVENT_SID, OS_E_PARAM_TASK);
+        return E_NOT_OK;
+    }
+#endif
+
+    Os_SetTaskEvent(TaskId, Mask);
+    return E_OK;
+}
+
+/*********************************************************************************************/
+/* Description: Check the queues configuration and empty the queues */
+STATIC Std_ReturnType Os_InitQueues(const Os_ConfigType * ConfigPtr)
+{
+#if (OS_CONFIGURED_QUEUES > 0U)
+    Os_QueueType queue;
+
+    Os_Queues = ConfigPtr->Queues;
+
+    for(queue = 0; queue < OS_CONFIGURED_QUEUES; queue++)
+    {
+        /* The slot indexes go up to Length so it must fit in 16 bits */
+        if((Os_Queues[queue].Buffer == NULL_PTR) || (Os_Queues[queue].Element_Size == 0)
+           || (Os_Queues[queue].Length == 0) || (Os_Queues[queue].Length == 0xFFFFU)
+           || ((Os_Queues[queue].Notify_Task != OS_QUEUE_NO_NOTIFICATION) && (Os_Queues[queue].Notify_Task >= OS_CONFIGURED_TASKS)))
+        {
+            return E_NOT_OK;
+        }
+        Os_QueueWrite[queue] = 0;
+        Os_QueueRead[queue]  = 0;
+    }
+#else
+    (void)ConfigPtr;
+#endif
+    return E_OK;
+}
+
+#if (OS_CONFIGURED_QUEUES > 0U)
+/*********************************************************************************************/
+Std_ReturnType Os_QueueSend(Os_QueueType QueueId, const void * DataPtr)
+{
+    const Os_QueueConfigType * queue;
+    const uint8 * source = (const uint8 *)DataPtr;
+    uint8 * destination;
+    uint16 write_slot;
+    uint16 next_slot;
+    uint16 byte;
+
+#if (OS_DEV_ERROR_DETECT == STD_ON)
+    if(QueueId >= OS_CONFIGURED_QUEUES)
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_QUEUE_SEND_SID, OS_E_PARAM_QUEUE);
+        return E_NOT_OK;
+    }
+    if(NULL_PTR == DataPtr)
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_QUEUE_SEND_SID, OS_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+#endif
+
+    queue = &Os_Queues[QueueId];
+    write_slot = Os_QueueWrite[QueueId];
+    next_slot  = (write_slot == queue->Length) ? 0 : (uint16)(write_slot + 1U);
+
+    /* Full queue: the next slot is still to be read by the consumer */
+    if(next_slot == Os_QueueRead[QueueId])
+    {
+        return E_NOT_OK;
+    }
+
+    destination = &queue->Buffer[write_slot * queue->Element_Size];
+    for(byte = 0; byte < queue->Element_Size; byte++)
+    {
+        destination[byte] = source[byte];
+    }
+
+    /* The element must be complete before the consumer can see the new write index */
+    Data_Memory_Barrier();
+    Os_QueueWrite[QueueId] = next_slot;
+
+    if(queue->Notify_Task != OS_QUEUE_NO_NOTIFICATION)
+    {
+        Os_SetTaskEvent(queue->Notify_Task, queue->Notify_Event);
+    }
+    return E_OK;
+}
+
+/*********************************************************************************************/
+Std_ReturnType Os_QueueReceive(Os_QueueType QueueId, void * DataPtr)
+{
+    const Os_QueueConfigType * queue;
+    const uint8 * source;
+    uint8 * destination = (uint8 *)DataPtr;
+    uint16 read_slot;
+    uint16 byte;
+
+#if (OS_DEV_ERROR_DETECT == STD_ON)
+    if(QueueId >= OS_CONFIGURED_QUEUES)
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_QUEUE_RECEIVE_SID, OS_E_PARAM_QUEUE);
+        return E_NOT_OK;
+    }
+    if(NULL_PTR == DataPtr)
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_QUEUE_RECEIVE_SID, OS_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+#endif
+
+    queue = &Os_Queues[QueueId];
+    read_slot = Os_QueueRead[QueueId];
 
-/* Global variable store the Os Time */
-static uint8 g_Time_Tick_Count = 0;
+    /* Empty queue */
+    if(read_slot == Os_QueueWrite[QueueId])
+    {
+        return E_NOT_OK;
+    }
+
+    /* The element is read only after the write index which published it */
+    Data_Memory_Barrier();
+    source = &queue->Buffer[read_slot * queue->Element_Size];
+    for(byte = 0; byte < queue->Element_Size; byte++)
+    {
+        destination[byte] = source[byte];
+    }
+
+    /* The element must be copied before the producer can reuse its slot */
+    Data_Memory_Barrier();
+    Os_QueueRead[QueueId] = (read_slot == queue->Length) ? 0 : (uint16)(read_slot + 1U);
+    return E_OK;
+}
+
+/*********************************************************************************************/
+Std_ReturnType Os_QueueGetCount(Os_QueueType QueueId, uint16 * CountPtr)
+{
+    uint16 write_slot;
+    uint16 read_slot;
+
+#if (OS_DEV_ERROR_DETECT == STD_ON)
+    if(QueueId >= OS_CONFIGURED_QUEUES)
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_QUEUE_GET_COUNT_SID, OS_E_PARAM_QUEUE);
+        return E_NOT_OK;
+    }
+    if(NULL_PTR == CountPtr)
+    {
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_QUEUE_GET_COUNT_SID, OS_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+#endif
+
+    write_slot = Os_QueueWrite[QueueId];
+    read_slot  = Os_QueueRead[QueueId];
+    if(write_slot >= read_slot)
+    {
+        *CountPtr = write_slot - read_slot;
+    }
+    else
+    {
+        *CountPtr = (uint16)((Os_Queues[QueueId].Length + 1U) - (read_slot - write_slot));
+    }
+    return E_OK;
+}
+#endif
+
+#if (OS_TICKLESS_IDLE == STD_ON)
+/*********************************************************************************************/
+/* Description: Called by the idle loop when there is nothing to run, it stretches the next
+ *              SysTick period up to the next slot having a due task and sleeps until an interrupt */
+STATIC void Os_IdleSleep(void)
+{
+    uint16 period_end_slot;
+    uint16 next_due_ticks;
+    uint32 alarm_ticks;
+    uint32 timer_ticks;
 
-/* Global variable to indicate the the timer has a new tick */
-static uint8 g_New_Time_Tick_Flag = 0;
+    Disable_Exceptions();
+
+#if (OS_PREEMPTIVE_MODE == STD_OFF)
+    /* A tick or an alarm activation may have arrived since the scheduler checked them */
+    if((g_Ticks_Received == g_Ticks_Processed) && (Os_ActivatedTasks == 0))
+#endif
+    {
+        /* Slot reached when the SysTick period in progress ends */
+        period_end_slot = (g_Time_Tick_Count + Os_TickStep_Current) % Os_HyperPeriod_Ticks;
+        next_due_ticks  = Os_NextDueTicks[period_end_slot];
+        if(next_due_ticks > OS_TICKLESS_MAX_TICKS)
+        {
+            next_due_ticks = OS_TICKLESS_MAX_TICKS;
+        }
+
+        /* The next alarm or timer expiry also ends the sleep, one started by a task while the period in
+         * progress was already stretched expires at the end of that period at the earliest */
+        alarm_ticks = Os_GetTicksToNextAlarm();
+        timer_ticks = Os_GetTicksToNextTimer();
+        if(timer_ticks < alarm_ticks)
+        {
+            alarm_ticks = timer_ticks;
+        }
+        if(alarm_ticks <= Os_TickStep_Current)
+        {
+            next_due_ticks = 1;
+        }
+        else if((alarm_ticks - Os_TickStep_Current) < next_due_ticks)
+        {
+            next_due_ticks = (uint16)(alarm_ticks - Os_TickStep_Current);
+        }
+
+        /* The new length is only taken by the hardware when the period in progress ends */
+        if((next_due_ticks != Os_TickStep_Next) && (SysTick_SetNextTime(next_due_ticks * OS_BASE_TIME) == E_OK))
+        {
+            Os_TickStep_Next = (uint8)next_due_ticks;
+        }
+
+        /* Sleep with the idle peripherals gated until the next interrupt, it is served as soon as
+         * the interrupts are enabled again */
+        Mcu_SetMode(OS_IDLE_MCU_MODE);
+    }
+
+    Enable_Exceptions();
+}
+#endif /* (OS_TICKLESS_IDLE == STD_ON) */
 
 /*********************************************************************************************/
 void Os_start(void)
 {
+#if (OS_PREEMPTIVE_MODE == STD_ON)
+    Os_TaskType task;
+#endif
+
+    /* Build the schedule table from the task configuration */
+    if(Os_BuildScheduleTable(&Os_Configuration) != E_OK)
+    {
+#if (OS_DEV_ERROR_DETECT == STD_ON)
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_START_SID, OS_E_PARAM_CONFIG);
+#endif
+        return;
+    }
+
+    /* Check the counters, alarms, schedule tables, queues, timers and resources and start the autostart alarms and tables */
+    if((Os_InitAlarms(&Os_Configuration) != E_OK) || (Os_InitScheduleTables(&Os_Configuration) != E_OK)
+       || (Os_InitQueues(&Os_Configuration) != E_OK) || (Os_InitTimers(&Os_Configuration) != E_OK)
+       || (Os_InitResources(&Os_Configuration) != E_OK))
+    {
+#if (OS_DEV_ERROR_DETECT == STD_ON)
+        Det_ReportError(OS_MODULE_ID, OS_INSTANCE_ID, OS_START_SID, OS_E_PARAM_CONFIG);
+#endif
+        return;
+    }
+
+#if (OS_STACK_MONITORING == STD_ON)
+    /* Paint the stacks before Init Task and the first tick use them */
+    Os_InitStacks();
+#endif
+
+#if ((OS_TASK_PROFILING == STD_ON) || (OS_CPU_LOAD_MEASUREMENT == STD_ON) || (OS_TRACE == STD_ON))
+    /* Enable the DWT cycle counter used to measure the tasks and the CPU load and to stamp the trace */
+    CORE_DEMCR_REG |= OS_DWT_TRACE_ENABLE_MASK;
+    DWT_CYCCNT_REG  = 0;
+    DWT_CTRL_REG   |= OS_DWT_CYCCNT_ENABLE_MASK;
+#endif
+
+#if (OS_PREEMPTIVE_MODE == STD_ON)
+    /* All the tasks wait for their first activation, the caller continues as the idle loop */
+    for(task = 0; task < OS_CONFIGURED_TASKS; task++)
+    {
+        Os_Tcb[task].State    = OS_TASK_SUSPENDED;
+        Os_Tcb[task].Priority = OS_TASK_PRIORITY(Os_Tasks[task].Priority);
+    }
+    Os_Tcb[OS_IDLE_TASK].State    = OS_TASK_RUNNING;
+    Os_Tcb[OS_IDLE_TASK].Priority = OS_TASK_PRIORITY(OS_IDLE_PRIORITY);
+    Os_Tcb[OS_IDLE_TASK].Resource_Top = 0;
+    Os_CurrentTask = OS_IDLE_TASK;
+
+    /* Assign the lowest priority to the PendSV exception */
+    NVIC_SYSTEM_PRI3_REG = (NVIC_SYSTEM_PRI3_REG & OS_PENDSV_PRIORITY_MASK) | (OS_PENDSV_PRIORITY << OS_PENDSV_PRIORITY_POS);
+
+    /* Thread mode continues on the process stack and the interrupts move to their own stack */
+    Os_CpuSwitchToProcessStack((uint32 *)((uint32)&Os_IsrStack[OS_ISR_STACK_SIZE] & ~(uint32)0x07));
+#endif
+
+    /* Execute the Init Task before the first tick so no task runs before the drivers are initialized */
+    Init_Task();
+
     /* Global Interrupts Enable */
     Enable_Exceptions();
     
     /* 
      * Set the Call Back function to call Os_NewTimerTick
-     * this function will be called every SysTick Interrupt (20ms)
+     * this function will be called every SysTick Interrupt (OS_BASE_TIME)
      */
     SysTick_SetCallBack(Os_NewTimerTick);
 
-    /* Start SysTickTimer to generate interrupt every 20ms */
-    SysTick_Start(OS_BASE_TIME);
+#if (OS_CPU_LOAD_MEASUREMENT == STD_ON)
+    /* The first hyperperiod starts with the first SysTick period */
+    Os_LoadWindowStart = DWT_CYCCNT_REG;
+#endif
 
-    /* Execute the Init Task */
-    Init_Task();
+    /* Start SysTickTimer to generate interrupt every OS_BASE_TIME */
+    SysTick_Start(OS_BASE_TIME);
 
     /* Start the Os Scheduler */
     Os_Scheduler();
@@ -58,49 +2930,185 @@ void Os_start(void)
 /*********************************************************************************************/
 void Os_NewTimerTick(void)
 {
-    /* Increment the Os time by OS_BASE_TIME */
-    g_Time_Tick_Count   += OS_BASE_TIME;
+    Os_TaskMaskType alarm_tasks;
+    uint8 ticks;
+
+#if (OS_TICKLESS_IDLE == STD_ON)
+    /* The period which just ended may cover several ticks (all of them without due tasks but the last one) */
+    ticks = Os_TickStep_Current;
+    Os_TickStep_Current = Os_TickStep_Next;
+
+    /* Go back to one tick periods, the idle loop stretches the next period again if nothing is due */
+    if((Os_TickStep_Next != 1U) && (SysTick_SetNextTime(OS_BASE_TIME) == E_OK))
+    {
+        Os_TickStep_Next = 1;
+    }
+#else
+    ticks = 1;
+#endif
+
+    /* Advance the Os time, this interrupt is its only writer */
+    Os_TickCount += ticks;
+    OS_TRACE_RECORD(OS_TRACE_TYPE_TICK, ticks, (uint16)Os_TickCount);
+
+#if (OS_CPU_LOAD_MEASUREMENT == STD_ON)
+    /* Compute the CPU load at the end of every hyperperiod */
+    Os_LoadTick(ticks);
+#endif
+
+#if (OS_STACK_MONITORING == STD_ON)
+    /* Catch a stack overflow within one tick */
+    Os_CheckStackGuards();
+#endif
+
+    /* Advance the counters and the timer wheel and run the actions of the expired alarms and timers */
+    alarm_tasks = Os_AdvanceCounters(ticks) | Os_AdvanceTimers(ticks);
+
+#if (OS_PREEMPTIVE_MODE == STD_ON)
+    /* Move to the slot reached, the table restarts every hyperperiod */
+    g_Time_Tick_Count += ticks;
+    if(g_Time_Tick_Count >= Os_HyperPeriod_Ticks)
+    {
+        g_Time_Tick_Count -= Os_HyperPeriod_Ticks;
+    }
+    g_Ticks_Received += ticks;
+
+    /* Activate the tasks due in this slot, the PendSV handler switches to them after this interrupt */
+    (void)Os_ActivateTasks(Os_ScheduleTable[g_Time_Tick_Count] | alarm_tasks);
+#else
+    if(alarm_tasks != 0)
+    {
+        (void)Os_QueueActivations(alarm_tasks);
+    }
+
+    /* Count the new ticks, the scheduler processes them one slot at a time so none is lost
+     * when the tasks of a slot take longer than OS_BASE_TIME */
+    g_Ticks_Received += ticks;
+#endif
+
+    OS_TRACE_RECORD(OS_TRACE_TYPE_ISR_EXIT, OS_TRACE_ISR_SYSTICK, 0);
+}
+
+/*********************************************************************************************/
+uint32 * Os_SwitchContext(uint32 * Stack_Ptr)
+{
+#if (OS_PREEMPTIVE_MODE == STD_ON)
+#if (OS_TASK_PROFILING == STD_ON)
+    /* The time the task stays preempted or waiting is not part of its execution time */
+    if((Os_CurrentTask != OS_IDLE_TASK) && (Os_Tcb[Os_CurrentTask].State != OS_TASK_TERMINATING)
+       && (Os_Tcb[Os_CurrentTask].State != OS_TASK_RESTARTING))
+    {
+        Os_TaskExec_Cycles[Os_CurrentTask] += DWT_CYCCNT_REG - Os_TaskExec_Start[Os_CurrentTask];
+    }
+#endif
+
+    /* Save the context of the running task, it stays ready unless it terminated: the context
+     * of a terminated task is dropped and a new one is prepared if it was activated meanwhile */
+    if(Os_Tcb[Os_CurrentTask].State == OS_TASK_TERMINATING)
+    {
+        Os_Tcb[Os_CurrentTask].State = OS_TASK_SUSPENDED;
+    }
+    else if(Os_Tcb[Os_CurrentTask].State == OS_TASK_RESTARTING)
+    {
+        Os_Tcb[Os_CurrentTask].Stack_Ptr = Os_InitTaskStack(Os_CurrentTask);
+        Os_Tcb[Os_CurrentTask].State     = OS_TASK_READY;
+    }
+    else
+    {
+        Os_Tcb[Os_CurrentTask].Stack_Ptr = Stack_Ptr;
+        if(Os_Tcb[Os_CurrentTask].State == OS_TASK_RUNNING)
+        {
+            Os_Tcb[Os_CurrentTask].State = OS_TASK_READY;
+        }
+    }
 
-    /* Set the flag to 1 to indicate that there is a new timer tick */
-    g_New_Time_Tick_Flag = 1;
+    /* Resume the highest priority ready task */
+    Os_CurrentTask = Os_GetHighestReadyTask();
+    Os_Tcb[Os_CurrentTask].State = OS_TASK_RUNNING;
+    OS_TRACE_RECORD(OS_TRACE_TYPE_TASK_SWITCH, Os_CurrentTask, 0);
+    if(Os_CurrentTask == OS_IDLE_TASK)
+    {
+        OS_LOAD_IDLE_ENTER();
+    }
+    else
+    {
+        OS_LOAD_IDLE_EXIT();
+    }
+#if (OS_TASK_PROFILING == STD_ON)
+    if(Os_CurrentTask != OS_IDLE_TASK)
+    {
+        Os_TaskExec_Start[Os_CurrentTask] = DWT_CYCCNT_REG;
+    }
+#endif
+    return Os_Tcb[Os_CurrentTask].Stack_Ptr;
+#else
+    /* Only one context exists in the cyclic executive */
+    return Stack_Ptr;
+#endif
 }
 
 /*********************************************************************************************/
 void Os_Scheduler(void)
 {
+#if (OS_PREEMPTIVE_MODE == STD_ON)
+    /* The caller continues as the idle task, the context switches account the next idle periods */
+    OS_LOAD_IDLE_ENTER();
+
     while(1)
     {
-	/* Code is only executed in case there is a new timer tick */
-	if(g_New_Time_Tick_Flag == 1)
-	{
-	    switch(g_Time_Tick_Count)
-            {
-		case 20:
-		case 100:
-			    Button_Task();
-			    g_New_Time_Tick_Flag = 0;
-			    break;
-		case 40:
-		case 80:
-			    Button_Task();
-			    Led_Task();
-			    g_New_Time_Tick_Flag = 0;
-			    break;
-		case 60:
-			    Button_Task();
-			    App_Task();
-			    g_New_Time_Tick_Flag = 0;
-			    break;
-		case 120:
-			    Button_Task();
-			    App_Task();
-			    Led_Task();
-			    g_New_Time_Tick_Flag = 0;
-			    g_Time_Tick_Count = 0;
-			    break;
-            }
-	}
+        /* Idle loop ... the tasks are dispatched by the tick interrupt and the PendSV handler */
+#if (OS_STACK_MONITORING == STD_ON)
+        Os_ScanStacks();
+#endif
+#if (OS_TICKLESS_IDLE == STD_ON)
+        Os_IdleSleep();
+#endif
     }
+#else
+    Os_TaskMaskType activated_tasks;
 
+    while(1)
+    {
+        /* Code is only executed in case there are pending timer ticks */
+        if(g_Ticks_Received != g_Ticks_Processed)
+        {
+#if (OS_CATCHUP_POLICY == OS_CATCHUP_SKIP)
+            /* Drop the late slots and only run the latest one, the tasks of the dropped slots lose their activation */
+            while((uint8)(g_Ticks_Received - g_Ticks_Processed) > 1U)
+            {
+                Os_NextSlot();
+                Os_ReportOverrun(Os_ScheduleTable[g_Time_Tick_Count], OS_OVERRUN_ACTIVATION_LOST);
+            }
+#endif
+            /* Late slots are executed one after another (OS_CATCHUP_EXECUTE_LATE) */
+            Os_NextSlot();
+
+            /* One table lookup gives all the tasks due in this slot, run them in Task Id order */
+            Os_RunTasks(Os_ScheduleTable[g_Time_Tick_Count]);
+        }
+
+        /* The tasks activated by the alarms run after the slot of the tick which activated them */
+        Disable_Exceptions();
+        activated_tasks = Os_ActivatedTasks;
+        Os_ActivatedTasks = 0;
+        Enable_Exceptions();
+
+        if(activated_tasks != 0)
+        {
+            Os_RunTasks(activated_tasks);
+        }
+        else if(g_Ticks_Received == g_Ticks_Processed)
+        {
+            /* Nothing to run until the next tick or activation */
+            OS_LOAD_IDLE_ENTER();
+#if (OS_STACK_MONITORING == STD_ON)
+            Os_ScanStacks();
+#endif
+#if (OS_TICKLESS_IDLE == STD_ON)
+            Os_IdleSleep();
+#endif
+        }
+    }
+#endif
 }
 /*********************************************************************************************/
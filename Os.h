@@ -12,24 +12,1211 @@
 #ifndef OS_H_
 #define OS_H_
 
+/* Os Module Id */
+#define OS_MODULE_ID    (1U)
+
+/* Os Instance Id */
+#define OS_INSTANCE_ID  (0U)
+
 #include "Std_Types.h"
 
-/* Timer counting time in ms */
-#define OS_BASE_TIME 20
+/* Os Pre-Compile Configuration Header file */
+#include "Os_Cfg.h"
+
+#if (OS_CONFIGURED_TASKS > 32U)
+  #error "The schedule table supports 32 Os Tasks at most"
+#endif
+
+#if (OS_CONFIGURED_TIMERS > 0xFFFEU)
+  #error "65534 Os Timers at most can be configured"
+#endif
+
+#if (OS_CONFIGURED_RESOURCES > 255U)
+  #error "255 Os Resources at most can be configured"
+#endif
+
+#if ((OS_TRACE_BUFFER_SIZE == 0U) || ((OS_TRACE_BUFFER_SIZE & (OS_TRACE_BUFFER_SIZE - 1U)) != 0U))
+  #error "The trace buffer size must be a power of 2"
+#endif
+
+#if ((OS_TIMER_WHEEL_LEVELS == 0U) || (OS_TIMER_WHEEL_LEVELS > 6U))
+  #error "The timer wheel supports 1 to 6 levels"
+#endif
+
+#if ((OS_CONFIGURED_ALARMS + OS_CONFIGURED_SCHEDULE_TABLES) > 255U)
+  #error "255 Os Alarms and Schedule Tables at most can be configured"
+#endif
+
+/******************************************************************************
+ *                      API Service Id Macros                                 *
+ ******************************************************************************/
+/* Service ID for Os start */
+#define OS_START_SID                   (uint8)0x00
+
+/* Service ID for Os get task profile */
+#define OS_GET_TASK_PROFILE_SID        (uint8)0x01
+
+/* Service ID for Os get task overruns */
+#define OS_GET_TASK_OVERRUNS_SID       (uint8)0x02
+
+/* Service ID for Os get elapsed time */
+#define OS_GET_ELAPSED_TIME_SID        (uint8)0x03
+
+/* Service ID for Os set relative alarm */
+#define OS_SET_REL_ALARM_SID           (uint8)0x04
+
+/* Service ID for Os set absolute alarm */
+#define OS_SET_ABS_ALARM_SID           (uint8)0x05
+
+/* Service ID for Os cancel alarm */
+#define OS_CANCEL_ALARM_SID            (uint8)0x06
+
+/* Service ID for Os get alarm */
+#define OS_GET_ALARM_SID               (uint8)0x07
+
+/* Service ID for Os get counter value */
+#define OS_GET_COUNTER_VALUE_SID       (uint8)0x08
+
+/* Service ID for Os get event */
+#define OS_GET_EVENT_SID               (uint8)0x09
+
+/* Service ID for Os clear event */
+#define OS_CLEAR_EVENT_SID             (uint8)0x0A
+
+/* Service ID for Os start schedule table relative */
+#define OS_START_SCHEDULE_TABLE_REL_SID    (uint8)0x0B
+
+/* Service ID for Os start schedule table absolute */
+#define OS_START_SCHEDULE_TABLE_ABS_SID    (uint8)0x0C
+
+/* Service ID for Os stop schedule table */
+#define OS_STOP_SCHEDULE_TABLE_SID         (uint8)0x0D
+
+/* Service ID for Os get schedule table status */
+#define OS_GET_SCHEDULE_TABLE_STATUS_SID   (uint8)0x0E
+
+/* Service ID for Os activate task */
+#define OS_ACTIVATE_TASK_SID           (uint8)0x0F
+
+/* Service ID for Os set event */
+#define OS_SET_EVENT_SID               (uint8)0x10
+
+/* Service ID for Os wait event */
+#define OS_WAIT_EVENT_SID              (uint8)0x11
+
+/* Service ID for Os queue send */
+#define OS_QUEUE_SEND_SID              (uint8)0x12
+
+/* Service ID for Os queue receive */
+#define OS_QUEUE_RECEIVE_SID           (uint8)0x13
+
+/* Service ID for Os queue get count */
+#define OS_QUEUE_GET_COUNT_SID         (uint8)0x14
+
+/* Service ID for Os start timer */
+#define OS_START_TIMER_SID             (uint8)0x15
+
+/* Service ID for Os stop timer */
+#define OS_STOP_TIMER_SID              (uint8)0x16
+
+/* Service ID for Os restart timer */
+#define OS_RESTART_TIMER_SID           (uint8)0x17
+
+/* Service ID for Os get timer */
+#define OS_GET_TIMER_SID               (uint8)0x18
+
+/* Service ID for Os coroutine start delay */
+#define OS_COROUTINE_START_DELAY_SID   (uint8)0x19
+
+/* Service ID for Os get cpu load */
+#define OS_GET_CPU_LOAD_SID            (uint8)0x1A
+
+/* Service ID for Os reset cpu load peak */
+#define OS_RESET_CPU_LOAD_PEAK_SID     (uint8)0x1B
+
+/* Service ID for Os get stack usage */
+#define OS_GET_STACK_USAGE_SID         (uint8)0x1C
+
+/* Service ID for Os get resource */
+#define OS_GET_RESOURCE_SID            (uint8)0x1D
+
+/* Service ID for Os release resource */
+#define OS_RELEASE_RESOURCE_SID        (uint8)0x1E
+
+/*******************************************************************************
+ *                      Overrun Hook Reasons                                   *
+ *******************************************************************************/
+/* The task was still running when the next tick arrived (its slot took longer than OS_BASE_TIME) */
+#define OS_OVERRUN_DEADLINE            (uint8)0x00
+
+/* An activation of the task was dropped: skipped slot or task still running from its previous activation */
+#define OS_OVERRUN_ACTIVATION_LOST     (uint8)0x01
+
+/*******************************************************************************
+ *                      Alarm Actions and Autostart                            *
+ *******************************************************************************/
+/* The expiry of the alarm activates its task */
+#define OS_ALARM_ACTION_ACTIVATETASK   (uint8)0x00
+
+/* The expiry of the alarm sets events of its task and activates the task to handle them */
+#define OS_ALARM_ACTION_SETEVENT       (uint8)0x01
+
+/* The expiry of the alarm calls its callback from the tick interrupt */
+#define OS_ALARM_ACTION_CALLBACK       (uint8)0x02
+
+/* The alarm is only started by Os_SetRelAlarm/Os_SetAbsAlarm */
+#define OS_ALARM_AUTOSTART_NONE        (uint8)0x00
+
+/* The alarm is started by Os_start, Alarm_Time relative to the counter value at start */
+#define OS_ALARM_AUTOSTART_RELATIVE    (uint8)0x01
+
+/* The alarm is started by Os_start, Alarm_Time is an absolute counter value */
+#define OS_ALARM_AUTOSTART_ABSOLUTE    (uint8)0x02
+
+/*******************************************************************************
+ *                      Schedule Table States and Autostart                    *
+ *******************************************************************************/
+/* The schedule table is not running */
+#define OS_SCHEDULETABLE_STOPPED       (uint8)0x00
+
+/* The schedule table processes its expiry points */
+#define OS_SCHEDULETABLE_RUNNING       (uint8)0x01
+
+/* The schedule table is only started by Os_StartScheduleTableRel/Os_StartScheduleTableAbs */
+#define OS_SCHEDULETABLE_AUTOSTART_NONE        (uint8)0x00
+
+/* The schedule table is started by Os_start, Start_Value is the offset from the counter value at start */
+#define OS_SCHEDULETABLE_AUTOSTART_RELATIVE    (uint8)0x01
+
+/* The schedule table is started by Os_start, Start_Value is an absolute counter value */
+#define OS_SCHEDULETABLE_AUTOSTART_ABSOLUTE    (uint8)0x02
+
+/*******************************************************************************
+ *                      DET Error Codes                                        *
+ *******************************************************************************/
+/* DET code to report an invalid task configuration (period/offset) or a too long hyperperiod */
+#define OS_E_PARAM_CONFIG              (uint8)0x01
+
+/* DET code to report an invalid Task Id */
+#define OS_E_PARAM_TASK                (uint8)0x02
+
+/* DET code to report a NULL pointer parameter */
+#define OS_E_PARAM_POINTER             (uint8)0x03
+
+/* DET code to report an invalid Alarm Id */
+#define OS_E_PARAM_ALARM               (uint8)0x04
+
+/* DET code to report an invalid Counter Id */
+#define OS_E_PARAM_COUNTER             (uint8)0x05
+
+/* DET code to report a counter value or a cycle outside the limits of the counter */
+#define OS_E_PARAM_VALUE               (uint8)0x06
+
+/* DET code to report an alarm already running (set) or not running (cancel/get) */
+#define OS_E_ALARM_STATE               (uint8)0x07
+
+/* DET code to report an invalid Schedule Table Id */
+#define OS_E_PARAM_SCHEDULE_TABLE      (uint8)0x08
+
+/* DET code to report a schedule table already running (start) or not running (stop) */
+#define OS_E_SCHEDULE_TABLE_STATE      (uint8)0x09
+
+/* DET code to report a service called from a context not allowed to use it */
+#define OS_E_CALL_LEVEL                (uint8)0x0A
+
+/* DET code to report an invalid Queue Id */
+#define OS_E_PARAM_QUEUE               (uint8)0x0B
+
+/* DET code to report an invalid Timer Id */
+#define OS_E_PARAM_TIMER               (uint8)0x0C
+
+/* DET code to report a timer already running, not running or never started */
+#define OS_E_TIMER_STATE               (uint8)0x0D
+
+/* DET code to report an invalid or not monitored Stack Id */
+#define OS_E_PARAM_STACK               (uint8)0x0E
+
+/* DET code to report an invalid Resource Id */
+#define OS_E_PARAM_RESOURCE            (uint8)0x0F
+
+/* DET code to report a resource already taken, released out of order or still taken by an ending or waiting task */
+#define OS_E_RESOURCE_STATE            (uint8)0x10
+
+/*******************************************************************************
+ *                      Queue Configuration Helpers                            *
+ *******************************************************************************/
+/* No task is woken up when an element is sent to the queue */
+#define OS_QUEUE_NO_NOTIFICATION       ((Os_TaskType)0xFF)
+
+/* Size in bytes of the buffer of a queue, one slot stays free to tell a full queue from an empty one */
+#define OS_QUEUE_BUFFER_SIZE(Length, Element_Size)   (((Length) + 1U) * (Element_Size))
+
+/*******************************************************************************
+ *                      Monitored Stacks                                       *
+ *******************************************************************************/
+/* The stack of a task (preemptive mode) has the Id of the task, then come: */
+
+/* The stack reserved by the startup code: all the tasks and interrupts in the cyclic executive,
+ * Init Task and the idle loop in preemptive mode */
+#define OS_STACK_MAIN                  ((Os_StackType)OS_CONFIGURED_TASKS)
+
+/* The stack of the interrupts in preemptive mode (OS_ISR_STACK_SIZE) */
+#define OS_STACK_ISR                   ((Os_StackType)(OS_CONFIGURED_TASKS + 1U))
+
+/*******************************************************************************
+ *                      Resources and Exclusive Areas                          *
+ *******************************************************************************/
+/* Interrupt ceiling of a resource only used by tasks: the interrupts are never masked */
+#define OS_RESOURCE_NO_ISR             (0U)
+
+/* Exclusive area of a module protected by an Os resource: the interrupts up to the ceiling of
+ * the resource users are masked (BASEPRI) and the tasks up to it are not scheduled, the more
+ * urgent interrupts and tasks keep running */
+#define OS_ENTER_EXCLUSIVE_AREA(ResourceId)   ((void)Os_GetResource(ResourceId))
+#define OS_EXIT_EXCLUSIVE_AREA(ResourceId)    ((void)Os_ReleaseResource(ResourceId))
+
+/*******************************************************************************
+ *                      Trace Records                                          *
+ *******************************************************************************/
+/* Types of the trace records, with the meaning of their Id and Data */
+#define OS_TRACE_TYPE_TASK_START       (uint8)0x01   /* Id: task */
+#define OS_TRACE_TYPE_TASK_END         (uint8)0x02   /* Id: task */
+#define OS_TRACE_TYPE_TASK_SWITCH      (uint8)0x03   /* Id: task resumed in preemptive mode, OS_CONFIGURED_TASKS for the idle loop */
+#define OS_TRACE_TYPE_TICK             (uint8)0x04   /* Id: ticks covered, Data: Os time in ticks (low 16 bits) */
+#define OS_TRACE_TYPE_ISR_ENTER        (uint8)0x05   /* Id: interrupt */
+#define OS_TRACE_TYPE_ISR_EXIT         (uint8)0x06   /* Id: interrupt */
+#define OS_TRACE_TYPE_OVERRUN          (uint8)0x07   /* Id: task, Data: OS_OVERRUN_xxx */
+#define OS_TRACE_TYPE_MARKER           (uint8)0x08   /* Id and Data: given by the application */
+
+/* Interrupt Id of the SysTick interrupt: it starts with the tick record and ends with an interrupt
+ * exit record, the application interrupts use the other Ids */
+#define OS_TRACE_ISR_SYSTICK           (uint8)0x00
+
+/* Trace points of the application, compiled out with OS_TRACE */
+#if (OS_TRACE == STD_ON)
+#define OS_TRACE_ISR_ENTER(IsrId)      Os_TraceRecord(OS_TRACE_TYPE_ISR_ENTER, (IsrId), 0)
+#define OS_TRACE_ISR_EXIT(IsrId)       Os_TraceRecord(OS_TRACE_TYPE_ISR_EXIT, (IsrId), 0)
+#define OS_TRACE_MARKER(Id, Data)      Os_TraceRecord(OS_TRACE_TYPE_MARKER, (Id), (Data))
+#else
+#define OS_TRACE_ISR_ENTER(IsrId)
+#define OS_TRACE_ISR_EXIT(IsrId)
+#define OS_TRACE_MARKER(Id, Data)
+#endif
+
+/*******************************************************************************
+ *                      CPU Load Scale                                         *
+ *******************************************************************************/
+/* The CPU loads are given in hundredths of percent: 10000 for a CPU never idle */
+#define OS_CPU_LOAD_FULL               (10000U)
+
+/*******************************************************************************
+ *                      Timer Wheel Range                                      *
+ *******************************************************************************/
+/* Every level of the timer wheel has 2^OS_TIMER_WHEEL_BITS slots */
+#define OS_TIMER_WHEEL_BITS            (5U)
+
+/* Longest timer in Os ticks (OS_BASE_TIME), for the first expiry and the cycle */
+#define OS_TIMER_MAX_TICKS             ((Os_TimerTickType)1 << (OS_TIMER_WHEEL_BITS * OS_TIMER_WHEEL_LEVELS))
+
+/*******************************************************************************
+ *                      Coroutine Macros                                       *
+ *******************************************************************************/
+/*
+ * Stackless coroutines (protothreads) for the tasks: a task written between
+ * OS_COROUTINE_BEGIN and OS_COROUTINE_END returns to the scheduler at every wait
+ * and continues after it at its next activation. Only the line of the wait is kept
+ * in the Os_CoroutineType context, so:
+ * - the local variables are lost at every wait, the state kept across waits must be static
+ * - a switch statement must not contain a wait
+ * - the task must be activated again to continue: yield activates it, a delay activates it
+ *   through the timer of the context (or its period), Os_SetEvent activates it for the events
+ */
+
+/* The coroutine has no timer, its delays only end at the next activations of the task (periodic task) */
+#define OS_COROUTINE_NO_TIMER          ((Os_TimerType)0xFFFF)
+
+/* Initializer of an Os_CoroutineType static context: the task running the coroutine and the
+ * timer activating it at the end of its delays (OS_ALARM_ACTION_ACTIVATETASK of the same task) */
+#define OS_COROUTINE_INIT(Task, Timer) { 0, (Task), (Timer), 0 }
+
+/* Start of the coroutine body, jumps to the wait where the last activation stopped */
+#define OS_COROUTINE_BEGIN(Coroutine)  switch((Coroutine)->Line) { case 0:
 
-/* Description: 
+/* End of the coroutine body, the next activation starts the body again */
+#define OS_COROUTINE_END(Coroutine)    } (Coroutine)->Line = 0
+
+/* Return to the scheduler until Condition is TRUE, it is evaluated again at every activation */
+#define OS_COROUTINE_WAIT_UNTIL(Coroutine, Condition)                                      \
+    do { (Coroutine)->Line = (uint16)__LINE__; case __LINE__:                              \
+         if(!(Condition)) { return; } } while(0)
+
+/* Return to the scheduler and continue at the next activation, the task activates itself */
+#define OS_COROUTINE_YIELD(Coroutine)                                                      \
+    do { (Coroutine)->Line = (uint16)__LINE__; (void)Os_ActivateTask((Coroutine)->Task);    \
+         return; case __LINE__: ; } while(0)
+
+/* Return to the scheduler for Ticks Os ticks (OS_BASE_TIME) */
+#define OS_COROUTINE_DELAY(Coroutine, Ticks)                                               \
+    do { Os_CoroutineStartDelay((Coroutine), (Ticks));                                      \
+         OS_COROUTINE_WAIT_UNTIL((Coroutine), Os_CoroutineDelayElapsed(Coroutine)); } while(0)
+
+/* Return to the scheduler until one of the events of Mask is set for the task, the events stay set
+ * until cleared with Os_ClearEvent */
+#define OS_COROUTINE_WAIT_EVENT(Coroutine, Mask)                                           \
+    OS_COROUTINE_WAIT_UNTIL((Coroutine), Os_CoroutineEventSet((Coroutine), (Mask)))
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Type definition for Os_TaskType used by the Os APIs (index of the task in Os_PBcfg.c) */
+typedef uint8 Os_TaskType;
+
+/* Type definition for Os_TaskMaskType, a set of tasks with one bit per Task Id */
+typedef uint32 Os_TaskMaskType;
+
+/* Type definition for Os_TickType, the Os time in OS_BASE_TIME ticks */
+typedef uint64 Os_TickType;
+
+/* Type definition for Os_TimeType, the Os time in ms */
+typedef uint64 Os_TimeType;
+
+/* Type definition for the Os Task entry function */
+typedef void (*Os_TaskFuncType)(void);
+
+/* Type definition for Os_CounterType used by the Os APIs (index of the counter in Os_PBcfg.c) */
+typedef uint8 Os_CounterType;
+
+/* Type definition for Os_AlarmType used by the Os APIs (index of the alarm in Os_PBcfg.c) */
+typedef uint8 Os_AlarmType;
+
+/* Type definition for Os_CounterTickType, a value or a number of increments of a counter */
+typedef uint32 Os_CounterTickType;
+
+/* Type definition for Os_EventMaskType, a set of events of a task with one bit per event */
+typedef uint32 Os_EventMaskType;
+
+/* Type definition for the alarm callback function */
+typedef void (*Os_AlarmCallbackType)(void);
+
+/* Type definition for Os_QueueType used by the Os APIs (index of the queue in Os_PBcfg.c) */
+typedef uint8 Os_QueueType;
+
+/* Type definition for Os_TimerType used by the Os APIs (index of the timer in Os_PBcfg.c) */
+typedef uint16 Os_TimerType;
+
+/* Type definition for Os_TimerTickType used by the timer APIs (Os ticks of OS_BASE_TIME) */
+typedef uint32 Os_TimerTickType;
+
+/* Context of a coroutine, a static variable of its task initialized with OS_COROUTINE_INIT */
+typedef struct
+{
+    /* Member contains the line of the wait to continue from, 0 at the start of the body */
+    uint16 Line;
+    /* Member contains the task running the coroutine */
+    Os_TaskType Task;
+    /* Member contains the timer activating the task at the end of a delay, OS_COROUTINE_NO_TIMER for none */
+    Os_TimerType Timer;
+    /* Member contains the Os tick count ending the delay in progress */
+    Os_TickType Wake_Tick;
+} Os_CoroutineType;
+
+/* Type definition for Os_ScheduleTableType used by the Os APIs (index of the schedule table in Os_PBcfg.c) */
+typedef uint8 Os_ScheduleTableType;
+
+/* Type definition for Os_ScheduleTableStatusType (OS_SCHEDULETABLE_STOPPED or OS_SCHEDULETABLE_RUNNING) */
+typedef uint8 Os_ScheduleTableStatusType;
+
+/* Type definition for Os_ResourceType used by the Os APIs (index of the resource in Os_PBcfg.c) */
+typedef uint8 Os_ResourceType;
+
+/* Type definition for Os_StackType used by the stack monitoring (task Id, OS_STACK_MAIN or OS_STACK_ISR) */
+typedef uint8 Os_StackType;
+
+typedef struct
+{
+    /* Member contains the address of the task entry function */
+    Os_TaskFuncType Task_Ptr;
+    /* Member contains the activation period of the task in ms, 0 for a task only activated
+     * by Os_ActivateTask, Os_SetEvent and the alarms/schedule tables */
+    uint16 Period;
+    /* Member contains the offset of the task activation inside its period in ms */
+    uint16 Offset;
+    /* Member contains the priority of the task in preemptive mode */
+    uint8 Priority;
+    /* Member contains the address of the task private stack in preemptive mode */
+    uint32 * Stack_Ptr;
+    /* Member contains the size of the task private stack in 32-bit words */
+    uint16 Stack_Size;
+} Os_TaskConfigType;
+
+typedef struct
+{
+    /* Member contains the maximum value of the counter, it wraps to 0 after it */
+    Os_CounterTickType Max_Allowed_Value;
+    /* Member contains the number of Os ticks (OS_BASE_TIME) per counter increment */
+    Os_CounterTickType Ticks_Per_Base;
+    /* Member contains the shortest cycle accepted for a cyclic alarm on the counter */
+    Os_CounterTickType Min_Cycle;
+} Os_CounterConfigType;
+
+typedef struct
+{
+    /* Member contains the counter driving the alarm */
+    Os_CounterType Counter;
+    /* Member contains the action done at expiry (OS_ALARM_ACTION_xxx) */
+    uint8 Action;
+    /* Member contains the task activated or receiving the events */
+    Os_TaskType Task;
+    /* Member contains the events set by OS_ALARM_ACTION_SETEVENT */
+    Os_EventMaskType Event;
+    /* Member contains the function called by OS_ALARM_ACTION_CALLBACK */
+    Os_AlarmCallbackType Callback;
+    /* Member contains how the alarm is started by Os_start (OS_ALARM_AUTOSTART_xxx) */
+    uint8 AutoStart;
+    /* Member contains the first expiry of an autostarted alarm in counter ticks */
+    Os_CounterTickType Alarm_Time;
+    /* Member contains the cycle of an autostarted alarm in counter ticks (0 for one-shot) */
+    Os_CounterTickType Cycle_Time;
+} Os_AlarmConfigType;
+
+typedef struct
+{
+    /* Member contains the offset of the expiry point from the start of the table in counter ticks */
+    Os_CounterTickType Offset;
+    /* Member contains the tasks activated by the expiry point */
+    Os_TaskMaskType Tasks;
+    /* Member contains the tasks receiving the events of the expiry point (they are activated too) */
+    Os_TaskMaskType Event_Tasks;
+    /* Member contains the events set for each task of Event_Tasks */
+    Os_EventMaskType Event;
+} Os_ExpiryPointConfigType;
+
+typedef struct
+{
+    /* Member contains the counter driving the schedule table */
+    Os_CounterType Counter;
+    /* Member contains the length of one round of the table in counter ticks */
+    Os_CounterTickType Duration;
+    /* Member contains TRUE if the table restarts after Duration, FALSE if it stops */
+    boolean Repeating;
+    /* Member contains the address of the expiry points sorted by offset */
+    const Os_ExpiryPointConfigType * Expiry_Points;
+    /* Member contains the number of expiry points */
+    uint8 Expiry_Points_Number;
+    /* Member contains how the table is started by Os_start (OS_SCHEDULETABLE_AUTOSTART_xxx) */
+    uint8 AutoStart;
+    /* Member contains the start offset or the start counter value of an autostarted table */
+    Os_CounterTickType Start_Value;
+} Os_ScheduleTableConfigType;
+
+typedef struct
+{
+    /* Member contains the address of the buffer, OS_QUEUE_BUFFER_SIZE(Length, Element_Size) bytes */
+    uint8 * Buffer;
+    /* Member contains the size of one element in bytes */
+    uint16 Element_Size;
+    /* Member contains the number of elements the queue holds */
+    uint16 Length;
+    /* Member contains the task woken up by every element sent, OS_QUEUE_NO_NOTIFICATION for none */
+    Os_TaskType Notify_Task;
+    /* Member contains the events set for Notify_Task (0 only activates it) */
+    Os_EventMaskType Notify_Event;
+} Os_QueueConfigType;
+
+typedef struct
+{
+    /* Member contains the highest priority of the tasks using the resource (preemptive mode) */
+    uint8 Task_Ceiling;
+    /* Member contains the highest NVIC priority (lowest value, 1 to 7) of the interrupts using the
+     * resource, OS_RESOURCE_NO_ISR when only tasks use it */
+    uint8 Isr_Ceiling;
+} Os_ResourceConfigType;
+
+typedef struct
+{
+    /* Member contains the action done at expiry (OS_ALARM_ACTION_xxx) */
+    uint8 Action;
+    /* Member contains the task activated or receiving the events */
+    Os_TaskType Task;
+    /* Member contains the events set by OS_ALARM_ACTION_SETEVENT */
+    Os_EventMaskType Event;
+    /* Member contains the function called by OS_ALARM_ACTION_CALLBACK */
+    Os_AlarmCallbackType Callback;
+} Os_TimerConfigType;
+
+/* Execution time statistics of a task measured with the DWT cycle counter */
+typedef struct
+{
+    /* Member contains the number of completed executions of the task */
+    uint32 Activations;
+    /* Member contains the shortest execution in CPU cycles */
+    uint32 Min_Cycles;
+    /* Member contains the longest execution in CPU cycles */
+    uint32 Max_Cycles;
+    /* Member contains the average execution in CPU cycles (computed by Os_GetTaskProfile) */
+    uint32 Average_Cycles;
+    /* Member contains the sum of all the executions in CPU cycles */
+    uint64 Total_Cycles;
+    /* Member contains the number of executions per OS_PROFILING_BUCKET_CYCLES wide bucket */
+    uint32 Histogram[OS_PROFILING_HISTOGRAM_BUCKETS];
+} Os_TaskProfileType;
+
+/* CPU load measured over every hyperperiod, in hundredths of percent (OS_CPU_LOAD_FULL) */
+typedef struct
+{
+    /* Member contains the load of the last completed hyperperiod */
+    uint16 Current;
+    /* Member contains the highest load of a hyperperiod since the start or Os_ResetCpuLoadPeak */
+    uint16 Peak;
+    /* Member contains the load averaged over the last 2^OS_CPU_LOAD_AVERAGE_SHIFT hyperperiods */
+    uint16 Average;
+    /* Member contains the number of completed hyperperiods */
+    uint32 Windows;
+} Os_CpuLoadType;
+
+/* Usage of a stack in 32-bit words */
+typedef struct
+{
+    /* Member contains the size of the stack */
+    uint16 Size;
+    /* Member contains the deepest use of the stack found by the high-water scan */
+    uint16 Max_Used;
+} Os_StackUsageType;
+
+/* Record of the event trace, OS_TRACE_TYPE_xxx gives the meaning of Id and Data */
+typedef struct
+{
+    /* Member contains the DWT cycle counter when the event was recorded */
+    uint32 Timestamp;
+    /* Member contains the type of the record (OS_TRACE_TYPE_xxx) */
+    uint8 Type;
+    /* Member contains the subject of the record: the task for TASK_START, TASK_END and OVERRUN,
+     * the task resumed for TASK_SWITCH (OS_CONFIGURED_TASKS for the idle loop), the ticks
+     * covered for TICK, the interrupt (OS_TRACE_ISR_xxx) for ISR_ENTER and ISR_EXIT and the
+     * value given by the application for MARKER */
+    uint8 Id;
+    /* Member contains the detail of the record: the Os time in ticks (low 16 bits) for TICK,
+     * the OS_OVERRUN_xxx reason for OVERRUN, the value given by the application for MARKER
+     * and 0 for the other types */
+    uint16 Data;
+} Os_TraceRecordType;
+
+/* Event trace ring buffer */
+typedef struct
+{
+    /* Member contains the number of records written since Os_start, the next record is written
+     * to Records[Count % OS_TRACE_BUFFER_SIZE] over the oldest one */
+    uint32 Count;
+    /* Member contains the last OS_TRACE_BUFFER_SIZE records */
+    Os_TraceRecordType Records[OS_TRACE_BUFFER_SIZE];
+} Os_TraceBufferType;
+
+/* Overrun counters of a task */
+typedef struct
+{
+    /* Member contains the number of executions still running when the next tick arrived */
+    uint32 Deadline_Overruns;
+    /* Member contains the number of dropped activations */
+    uint32 Lost_Activations;
+} Os_TaskOverrunType;
+
+/* Data Structure required for building the Os schedule table */
+typedef struct Os_ConfigType
+{
+    Os_TaskConfigType Tasks[OS_CONFIGURED_TASKS];
+    Os_CounterConfigType Counters[OS_CONFIGURED_COUNTERS];
+#if (OS_CONFIGURED_ALARMS > 0U)
+    Os_AlarmConfigType Alarms[OS_CONFIGURED_ALARMS];
+#endif
+#if (OS_CONFIGURED_SCHEDULE_TABLES > 0U)
+    Os_ScheduleTableConfigType ScheduleTables[OS_CONFIGURED_SCHEDULE_TABLES];
+#endif
+#if (OS_CONFIGURED_QUEUES > 0U)
+    Os_QueueConfigType Queues[OS_CONFIGURED_QUEUES];
+#endif
+#if (OS_CONFIGURED_TIMERS > 0U)
+    Os_TimerConfigType Timers[OS_CONFIGURED_TIMERS];
+#endif
+#if (OS_CONFIGURED_RESOURCES > 0U)
+    Os_ResourceConfigType Resources[OS_CONFIGURED_RESOURCES];
+#endif
+} Os_ConfigType;
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/* Description:
  * Function responsible for:
  * 1. Enable Interrupts
- * 2. Start the Os timer
- * 3. Execute the Init Task
- * 4. Start the Scheduler to run the tasks
+ * 2. Build the schedule table from the task configuration
+ * 3. Start the Os timer
+ * 4. Execute the Init Task
+ * 5. Start the Scheduler to run the tasks
  */
 void Os_start(void);
 
 /* Description: The Engine of the Os Scheduler used for switch between different tasks */
 void Os_Scheduler(void);
 
-/* Description: Function called by the Timer Driver in the MCAL layer using the call back pointer */
+/* Description: Function called by the Timer Driver in the MCAL layer using the call back pointer,
+ *              it advances the Os time and the counters and processes the expired alarms */
 void Os_NewTimerTick(void);
 
+/*
+ * Description: Function called by the PendSV handler with the interrupts disabled after it saved
+ *              the context of the running task on its stack. It stores the stack pointer of the
+ *              running task and returns the stack pointer of the highest priority ready task.
+ */
+uint32 * Os_SwitchContext(uint32 * Stack_Ptr);
+
+/************************************************************************************
+* Service Name: Os_GetTaskOverruns
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): TaskId - Id of the Os Task
+* Parameters (inout): None
+* Parameters (out): OverrunPtr - Pointer to where to store the overrun counters
+* Return value: Std_ReturnType - E_OK or E_NOT_OK in case of invalid parameters
+* Description: Function to get the deadline overruns and the lost activations of a task.
+************************************************************************************/
+Std_ReturnType Os_GetTaskOverruns(Os_TaskType TaskId, Os_TaskOverrunType * OverrunPtr);
+
+/************************************************************************************
+* Service Name: Os_GetTickCount
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Os_TickType - Number of OS_BASE_TIME ticks since the Os started
+* Description: Function to read the free running Os tick counter, it can be called
+*              from the tasks and from the interrupts.
+************************************************************************************/
+Os_TickType Os_GetTickCount(void);
+
+/************************************************************************************
+* Service Name: Os_GetTime
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Os_TimeType - Time in ms since the Os started (OS_BASE_TIME resolution)
+* Description: Function to read the monotonic Os time, it can be called from the
+*              tasks and from the interrupts.
+************************************************************************************/
+Os_TimeType Os_GetTime(void);
+
+/************************************************************************************
+* Service Name: Os_GetElapsedTime
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): PreviousTimePtr - Time of the previous call, updated with the current time
+* Parameters (out): None
+* Return value: Os_TimeType - Time in ms elapsed since *PreviousTimePtr
+* Description: Function to measure the time between two calls of the same caller.
+************************************************************************************/
+Os_TimeType Os_GetElapsedTime(Os_TimeType * PreviousTimePtr);
+
+#if (OS_CONFIGURED_ALARMS > 0U)
+/************************************************************************************
+* Service Name: Os_SetRelAlarm
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): AlarmId - Id of the Os Alarm
+*                  Increment - Counter ticks from now to the first expiry (1 .. max value)
+*                  Cycle - Counter ticks between the next expiries, 0 for a one-shot alarm
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_OK or E_NOT_OK in case of invalid parameters or
+*                                if the alarm is already running
+* Description: Function to start an alarm relative to the current value of its counter.
+************************************************************************************/
+Std_ReturnType Os_SetRelAlarm(Os_AlarmType AlarmId, Os_CounterTickType Increment, Os_CounterTickType Cycle);
+
+/************************************************************************************
+* Service Name: Os_SetAbsAlarm
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): AlarmId - Id of the Os Alarm
+*                  Start - Counter value of the first expiry (0 .. max value)
+*                  Cycle - Counter ticks between the next expiries, 0 for a one-shot alarm
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_OK or E_NOT_OK in case of invalid parameters or
+*                                if the alarm is already running
+* Description: Function to start an alarm at an absolute value of its counter, a Start
+*              equal to the current value expires after a full counter round.
+************************************************************************************/
+Std_ReturnType Os_SetAbsAlarm(Os_AlarmType AlarmId, Os_CounterTickType Start, Os_CounterTickType Cycle);
+
+/************************************************************************************
+* Service Name: Os_CancelAlarm
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): AlarmId - Id of the Os Alarm
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_OK or E_NOT_OK if the Id is invalid or the alarm is not running
+* Description: Function to stop a running alarm.
+************************************************************************************/
+Std_ReturnType Os_CancelAlarm(Os_AlarmType AlarmId);
+
+/************************************************************************************
+* Service Name: Os_GetAlarm
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): AlarmId - Id of the Os Alarm
+* Parameters (inout): None
+* Parameters (out): TicksPtr - Pointer to where to store the counter ticks left before the expiry
+* Return value: Std_ReturnType - E_OK or E_NOT_OK in case of invalid parameters or
+*                                if the alarm is not running
+* Description: Function to get the time left before the next expiry of an alarm.
+************************************************************************************/
+Std_ReturnType Os_GetAlarm(Os_AlarmType AlarmId, Os_CounterTickType * TicksPtr);
+#endif
+
+/************************************************************************************
+* Service Name: Os_GetCounterValue
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): CounterId - Id of the Os Counter
+* Parameters (inout): None
+* Parameters (out): ValuePtr - Pointer to where to store the current value of the counter
+* Return value: Std_ReturnType - E_OK or E_NOT_OK in case of invalid parameters
+* Description: Function to read the current value of a counter.
+************************************************************************************/
+Std_ReturnType Os_GetCounterValue(Os_CounterType CounterId, Os_CounterTickType * ValuePtr);
+
+#if (OS_CONFIGURED_SCHEDULE_TABLES > 0U)
+/************************************************************************************
+* Service Name: Os_StartScheduleTableRel
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): TableId - Id of the Os Schedule Table
+*                  Offset - Counter ticks from now to the start of the table (offset 0)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_OK or E_NOT_OK in case of invalid parameters or
+*                                if the table is already running
+* Description: Function to start a schedule table relative to the current value of its counter,
+*              the first expiry point is processed after Offset plus its own offset.
+************************************************************************************/
+Std_ReturnType Os_StartScheduleTableRel(Os_ScheduleTableType TableId, Os_CounterTickType Offset);
+
+/************************************************************************************
+* Service Name: Os_StartScheduleTableAbs
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): TableId - Id of the Os Schedule Table
+*                  Start - Counter value of the start of the table (offset 0)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_OK or E_NOT_OK in case of invalid parameters or
+*                                if the table is already running
+* Description: Function to start a schedule table at an absolute value of its counter.
+************************************************************************************/
+Std_ReturnType Os_StartScheduleTableAbs(Os_ScheduleTableType TableId, Os_CounterTickType Start);
+
+/************************************************************************************
+* Service Name: Os_StopScheduleTable
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): TableId - Id of the Os Schedule Table
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_OK or E_NOT_OK if the Id is invalid or the table is not running
+* Description: Function to stop a running schedule table, its next expiry points are not processed.
+************************************************************************************/
+Std_ReturnType Os_StopScheduleTable(Os_ScheduleTableType TableId);
+
+/************************************************************************************
+* Service Name: Os_GetScheduleTableStatus
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): TableId - Id of the Os Schedule Table
+* Parameters (inout): None
+* Parameters (out): StatusPtr - Pointer to where to store the state of the table
+* Return value: Std_ReturnType - E_OK or E_NOT_OK in case of invalid parameters
+* Description: Function to get the state of a schedule table.
+************************************************************************************/
+Std_ReturnType Os_GetScheduleTableStatus(Os_ScheduleTableType TableId, Os_ScheduleTableStatusType * StatusPtr);
+#endif
+
+#if (OS_CONFIGURED_TIMERS > 0U)
+/************************************************************************************
+* Service Name: Os_StartTimer
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): TimerId - Id of the Os Timer
+*                  Ticks - Os ticks before the first expiry (1 to OS_TIMER_MAX_TICKS)
+*                  Cycle - Os ticks between the next expiries (0 for a one-shot timer)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_OK or E_NOT_OK in case of invalid parameters or
+*                                if the timer is already running
+* Description: Function to start a stopped software timer. Starting, stopping and the
+*              processing of the timers by every tick take a constant time whatever
+*              the number of running timers (hierarchical timer wheel).
+************************************************************************************/
+Std_ReturnType Os_StartTimer(Os_TimerType TimerId, Os_TimerTickType Ticks, Os_TimerTickType Cycle);
+
+/************************************************************************************
+* Service Name: Os_StopTimer
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): TimerId - Id of the Os Timer
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_OK or E_NOT_OK if the Id is invalid or the timer is not running
+* Description: Function to stop a running software timer.
+************************************************************************************/
+Std_ReturnType Os_StopTimer(Os_TimerType TimerId);
+
+/************************************************************************************
+* Service Name: Os_RestartTimer
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): TimerId - Id of the Os Timer
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_OK or E_NOT_OK if the Id is invalid or the timer was never started
+* Description: Function to start a timer again with the Ticks and Cycle of its last
+*              Os_StartTimer, running or not (timeout supervision).
+************************************************************************************/
+Std_ReturnType Os_RestartTimer(Os_TimerType TimerId);
+
+/************************************************************************************
+* Service Name: Os_GetTimer
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): TimerId - Id of the Os Timer
+* Parameters (inout): None
+* Parameters (out): TicksPtr - Pointer to where to store the Os ticks left before the expiry
+* Return value: Std_ReturnType - E_OK or E_NOT_OK in case of invalid parameters or
+*                                if the timer is not running
+* Description: Function to get the time left before the next expiry of a timer.
+************************************************************************************/
+Std_ReturnType Os_GetTimer(Os_TimerType TimerId, Os_TimerTickType * TicksPtr);
+#endif
+
+#if (OS_CONFIGURED_RESOURCES > 0U)
+/************************************************************************************
+* Service Name: Os_GetResource
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ResId - Id of the Os Resource
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_OK or E_NOT_OK if the Id is invalid or the resource is taken
+* Description: Function to enter the critical section of a resource (priority ceiling protocol):
+*              BASEPRI masks the interrupts up to the interrupt ceiling of the resource and the
+*              calling task runs at the task ceiling so no other user of the resource can run.
+*              The resources are released in the reverse order and before the task ends or waits.
+************************************************************************************/
+Std_ReturnType Os_GetResource(Os_ResourceType ResId);
+
+/************************************************************************************
+* Service Name: Os_ReleaseResource
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ResId - Id of the Os Resource
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_OK or E_NOT_OK if the Id is invalid or the resource is not
+*                                the last one taken
+* Description: Function to leave the critical section of a resource, the interrupt mask and the
+*              task priority return to their values before Os_GetResource.
+************************************************************************************/
+Std_ReturnType Os_ReleaseResource(Os_ResourceType ResId);
+#endif
+
+/************************************************************************************
+* Service Name: Os_CoroutineStartDelay
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant (one call per coroutine at a time)
+* Parameters (in): Ticks - Os ticks of the delay (1 to OS_TIMER_MAX_TICKS)
+* Parameters (inout): Coroutine - Context of the coroutine
+* Parameters (out): None
+* Return value: None
+* Description: Function used by OS_COROUTINE_DELAY to start a delay, the timer of the
+*              coroutine is (re)started to activate the task at its end.
+************************************************************************************/
+void Os_CoroutineStartDelay(Os_CoroutineType * Coroutine, Os_TimerTickType Ticks);
+
+/************************************************************************************
+* Service Name: Os_CoroutineDelayElapsed
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Coroutine - Context of the coroutine
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - TRUE when the delay started by Os_CoroutineStartDelay ended
+* Description: Function used by OS_COROUTINE_DELAY to check the end of a delay.
+************************************************************************************/
+boolean Os_CoroutineDelayElapsed(const Os_CoroutineType * Coroutine);
+
+/************************************************************************************
+* Service Name: Os_CoroutineEventSet
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Coroutine - Context of the coroutine
+*                  Mask - Events waited for
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - TRUE when one of the events of Mask is set for the task of the coroutine
+* Description: Function used by OS_COROUTINE_WAIT_EVENT to check the events.
+************************************************************************************/
+boolean Os_CoroutineEventSet(const Os_CoroutineType * Coroutine, Os_EventMaskType Mask);
+
+/************************************************************************************
+* Service Name: Os_ActivateTask
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): TaskId - Id of the Os Task
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_OK or E_NOT_OK if the Id is invalid or the task is
+*                                still pending from a previous activation (activation lost)
+* Description: Function to activate a task from a task or an interrupt, the task runs at
+*              the next dispatch: after the slot in progress in the cyclic executive,
+*              according to its priority in preemptive mode.
+************************************************************************************/
+Std_ReturnType Os_ActivateTask(Os_TaskType TaskId);
+
+/************************************************************************************
+* Service Name: Os_SetEvent
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): TaskId - Id of the Os Task
+*                  Mask - Events to set
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_OK or E_NOT_OK in case of invalid parameters
+* Description: Function to set events of a task from a task or an interrupt. A task waiting
+*              for one of them in Os_WaitEvent continues, a task not running is activated
+*              to handle them, a running task sees them with Os_GetEvent.
+************************************************************************************/
+Std_ReturnType Os_SetEvent(Os_TaskType TaskId, Os_EventMaskType Mask);
+
+#if (OS_PREEMPTIVE_MODE == STD_ON)
+/************************************************************************************
+* Service Name: Os_WaitEvent
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Mask - Events to wait for
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_OK or E_NOT_OK if not called by a task
+* Description: Function to block the calling task until one of the events is set, the
+*              events stay set until cleared with Os_ClearEvent. Only available in
+*              preemptive mode where every task has its own stack, a task of the cyclic
+*              executive waits by returning and Os_SetEvent activates it again.
+************************************************************************************/
+Std_ReturnType Os_WaitEvent(Os_EventMaskType Mask);
+#endif
+
+#if (OS_CONFIGURED_QUEUES > 0U)
+/************************************************************************************
+* Service Name: Os_QueueSend
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant (one producer per queue)
+* Parameters (in): QueueId - Id of the Os Queue
+*                  DataPtr - Pointer to the element to copy in the queue
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_OK or E_NOT_OK in case of invalid parameters or full queue
+* Description: Function to send an element to a queue from a single task or interrupt.
+*              It never waits nor disables the interrupts, the producer only writes the
+*              write index and the consumer only writes the read index. The notified
+*              task is woken up through Os_SetEvent.
+************************************************************************************/
+Std_ReturnType Os_QueueSend(Os_QueueType QueueId, const void * DataPtr);
+
+/************************************************************************************
+* Service Name: Os_QueueReceive
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant (one consumer per queue)
+* Parameters (in): QueueId - Id of the Os Queue
+* Parameters (inout): None
+* Parameters (out): DataPtr - Pointer to where to copy the oldest element
+* Return value: Std_ReturnType - E_OK or E_NOT_OK in case of invalid parameters or empty queue
+* Description: Function to take the oldest element of a queue from a single task or interrupt,
+*              it never waits nor disables the interrupts.
+************************************************************************************/
+Std_ReturnType Os_QueueReceive(Os_QueueType QueueId, void * DataPtr);
+
+/************************************************************************************
+* Service Name: Os_QueueGetCount
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): QueueId - Id of the Os Queue
+* Parameters (inout): None
+* Parameters (out): CountPtr - Pointer to where to store the number of elements in the queue
+* Return value: Std_ReturnType - E_OK or E_NOT_OK in case of invalid parameters
+* Description: Function to get the number of elements waiting in a queue.
+************************************************************************************/
+Std_ReturnType Os_QueueGetCount(Os_QueueType QueueId, uint16 * CountPtr);
+#endif
+
+/************************************************************************************
+* Service Name: Os_GetEvent
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): TaskId - Id of the Os Task
+* Parameters (inout): None
+* Parameters (out): EventPtr - Pointer to where to store the events set for the task
+* Return value: Std_ReturnType - E_OK or E_NOT_OK in case of invalid parameters
+* Description: Function to read the events set for a task, they stay set until cleared.
+************************************************************************************/
+Std_ReturnType Os_GetEvent(Os_TaskType TaskId, Os_EventMaskType * EventPtr);
+
+/************************************************************************************
+* Service Name: Os_ClearEvent
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): TaskId - Id of the Os Task
+*                  Mask - Events to clear
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_OK or E_NOT_OK in case of invalid parameters
+* Description: Function to clear the events of a task once they are handled.
+************************************************************************************/
+Std_ReturnType Os_ClearEvent(Os_TaskType TaskId, Os_EventMaskType Mask);
+
+#if (OS_STACK_MONITORING == STD_ON)
+/************************************************************************************
+* Service Name: Os_GetStackUsage
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): StackId - Task Id, OS_STACK_MAIN or OS_STACK_ISR
+* Parameters (inout): None
+* Parameters (out): UsagePtr - Pointer to where to store the size and the high-water mark
+* Return value: Std_ReturnType - E_OK or E_NOT_OK in case of invalid parameters or if
+*                                the stack does not exist in this kernel mode
+* Description: Function to get the deepest use of a stack since Os_start, the painted words
+*              are scanned in the idle time so the mark follows the use with some delay.
+************************************************************************************/
+Std_ReturnType Os_GetStackUsage(Os_StackType StackId, Os_StackUsageType * UsagePtr);
+
+/*
+ * Description: Hook implemented by the application and called once per stack from the tick
+ *              interrupt when the guard words at the bottom of the stack were overwritten.
+ *              The memory under the stack may be corrupted, the application should stop or reset.
+ */
+void Os_StackOverflowHook(Os_StackType StackId);
+#endif
+
+#if (OS_OVERRUN_HOOK == STD_ON)
+/*
+ * Description: Hook implemented by the application and called by the Os for every overrun
+ *              of a task (Reason: OS_OVERRUN_DEADLINE or OS_OVERRUN_ACTIVATION_LOST).
+ *              It may be called from the tick interrupt.
+ */
+void Os_OverrunHook(Os_TaskType TaskId, uint8 Reason);
+#endif
+
+#if (OS_TASK_PROFILING == STD_ON)
+/************************************************************************************
+* Service Name: Os_GetTaskProfile
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): TaskId - Id of the Os Task
+* Parameters (inout): None
+* Parameters (out): ProfilePtr - Pointer to where to store the execution time statistics
+* Return value: Std_ReturnType - E_OK or E_NOT_OK in case of invalid parameters
+* Description: Function to get the min/max/average execution time and the histogram of a task.
+************************************************************************************/
+Std_ReturnType Os_GetTaskProfile(Os_TaskType TaskId, Os_TaskProfileType * ProfilePtr);
+#endif
+
+#if (OS_CPU_LOAD_MEASUREMENT == STD_ON)
+/************************************************************************************
+* Service Name: Os_GetCpuLoad
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): LoadPtr - Pointer to where to store the current, peak and average loads
+* Return value: Std_ReturnType - E_OK or E_NOT_OK in case of invalid parameters
+* Description: Function to get the CPU load: the share of every hyperperiod the CPU spent
+*              out of the idle loop (tasks, interrupts while a task runs and Os overhead).
+************************************************************************************/
+Std_ReturnType Os_GetCpuLoad(Os_CpuLoadType * LoadPtr);
+
+/************************************************************************************
+* Service Name: Os_ResetCpuLoadPeak
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to start the peak load again from the current load.
+************************************************************************************/
+void Os_ResetCpuLoadPeak(void);
+#endif
+
+#if (OS_TRACE == STD_ON)
+/************************************************************************************
+* Service Name: Os_TraceRecord
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Type - OS_TRACE_TYPE_xxx
+*                  Id - Task, interrupt or marker Id
+*                  Data - Data of the record
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to add a record stamped with the cycle counter to the trace ring buffer,
+*              used through OS_TRACE_ISR_ENTER, OS_TRACE_ISR_EXIT and OS_TRACE_MARKER.
+************************************************************************************/
+void Os_TraceRecord(uint8 Type, uint8 Id, uint16 Data);
+
+/************************************************************************************
+* Service Name: Os_TraceStop
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to freeze the trace, called from a hook it keeps the events which led
+*              to a fault until the buffer is dumped.
+************************************************************************************/
+void Os_TraceStop(void);
+
+/************************************************************************************
+* Service Name: Os_TraceStart
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to continue the trace after Os_TraceStop.
+************************************************************************************/
+void Os_TraceStart(void);
+#endif
+
+/*******************************************************************************
+ *                       External Variables                                    *
+ *******************************************************************************/
+
+/* Extern PB structures to be used by Os */
+extern const Os_ConfigType Os_Configuration;
+
+#if (OS_CPU_LOAD_MEASUREMENT == STD_ON)
+/* CPU load updated at the end of every hyperperiod, to be watched in the debugger */
+extern volatile Os_CpuLoadType Os_CpuLoad;
+#endif
+
+#if (OS_TRACE == STD_ON)
+/* Event trace ring buffer, dumped from the debugger and decoded by tools/os_trace.py */
+extern volatile Os_TraceBufferType Os_Trace;
+#endif
+
 #endif /* OS_H_ */
@@ -0,0 +1,173 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for Os Scheduler.
+ *
+ * Author: Yahia Hamimi
+ ******************************************************************************/
+
+#ifndef OS_CFG_H_
+#define OS_CFG_H_
+
+/* Pre-compile option for Development Error Detect */
+#define OS_DEV_ERROR_DETECT                  (STD_ON)
+
+/* Pre-compile option for the preemptive kernel mode:
+ * STD_OFF --> the tasks run to completion one after another inside Os_Scheduler (cyclic executive)
+ * STD_ON  --> each task runs on its own stack with a fixed priority and a higher priority task
+ *             preempts a lower priority one through the PendSV handler */
+#define OS_PREEMPTIVE_MODE                   (STD_OFF)
+
+/* Pre-compile option for the tickless idle mode: when no task is due in the next ticks the
+ * SysTick period is stretched up to the next due task and the CPU sleeps (WFI) until then */
+#define OS_TICKLESS_IDLE                     (STD_ON)
+
+/* Longest sleep in OS_BASE_TIME ticks (up to 255), the Gpt driver counts a sleep longer than the
+ * 24-bit SysTick reload range in several chunks */
+#define OS_TICKLESS_MAX_TICKS                (50U)
+
+/* Mcu mode of the tickless idle sleep: a sleep mode only, the deep-sleep clock would slow the SysTick down */
+#define OS_IDLE_MCU_MODE                     (McuConf_SLEEP_MODE_ID)
+
+/* Pre-compile option for the per task execution time profiling with the DWT cycle counter */
+#define OS_TASK_PROFILING                    (STD_OFF)
+
+/* Number of buckets in the execution time histogram of each task */
+#define OS_PROFILING_HISTOGRAM_BUCKETS       (8U)
+
+/* Width of a histogram bucket in CPU cycles, the last bucket collects all the longer executions */
+#define OS_PROFILING_BUCKET_CYCLES           (2000U)
+
+/* Pre-compile option for the CPU load measurement: busy versus idle cycles of every hyperperiod
+ * measured with the DWT cycle counter, read with Os_GetCpuLoad or the Os_CpuLoad debug variable */
+#define OS_CPU_LOAD_MEASUREMENT              (STD_ON)
+
+/* The average load follows the load of the last 2^OS_CPU_LOAD_AVERAGE_SHIFT hyperperiods */
+#define OS_CPU_LOAD_AVERAGE_SHIFT            (3U)
+
+/* Catch-up policies used when several ticks are pending because the tasks of a slot took longer than OS_BASE_TIME */
+#define OS_CATCHUP_EXECUTE_LATE              (0U)   /* Run every late slot one after another */
+#define OS_CATCHUP_SKIP                      (1U)   /* Drop the late slots and only run the latest one */
+
+/* Catch-up policy of the cyclic executive */
+#define OS_CATCHUP_POLICY                    (OS_CATCHUP_EXECUTE_LATE)
+
+/* Pre-compile option to call Os_OverrunHook on every deadline overrun or lost activation */
+#define OS_OVERRUN_HOOK                      (STD_ON)
+
+/* Timer counting time in ms, half the shortest task period so the task offsets can stagger
+ * the activations over different ticks */
+#define OS_BASE_TIME                         (10U)
+
+/* Number of the configured Os Tasks (one bit per task in the schedule table so 32 tasks at most) */
+#define OS_CONFIGURED_TASKS                  (3U)
+
+/* Size of the schedule table: the longest hyperperiod supported in OS_BASE_TIME ticks */
+#define OS_MAX_HYPERPERIOD_TICKS             (64U)
+
+/* Task Index in the array of structures in Os_PBcfg.c
+ * Tasks due in the same tick are executed in the order of their index */
+#define OsConf_BUTTON_TASK_ID_INDEX          (uint8)0x00
+#define OsConf_APP_TASK_ID_INDEX             (uint8)0x01
+#define OsConf_LED_TASK_ID_INDEX             (uint8)0x02
+
+/* Os Tasks activation period in ms (multiple of OS_BASE_TIME)
+ * 0 for an event driven task: App Task is activated by Button Task when the button state changes */
+#define OsConf_BUTTON_TASK_PERIOD            (20U)
+#define OsConf_APP_TASK_PERIOD               (0U)
+#define OsConf_LED_TASK_PERIOD               (40U)
+
+/* Os Tasks activation offset inside the period in ms (multiple of OS_BASE_TIME, 0 for an event driven task)
+ * Button Task alone in the even ticks, Led Task in the odd ticks */
+#define OsConf_BUTTON_TASK_OFFSET            (0U)
+#define OsConf_APP_TASK_OFFSET               (0U)
+#define OsConf_LED_TASK_OFFSET               (10U)
+
+/* Shortest time in ms between two activations of an event driven task, not used by the firmware
+ * but read by tools/os_analysis.py (the button state cannot change faster than BUTTON_DEBOUNCE_TIME) */
+#define OsConf_APP_TASK_MIN_INTERARRIVAL     (40U)
+
+/* Os Tasks priority in preemptive mode (higher value is higher priority, must be unique,
+ * 0 is reserved for the idle loop) */
+#define OsConf_BUTTON_TASK_PRIORITY          (3U)
+#define OsConf_APP_TASK_PRIORITY             (1U)
+#define OsConf_LED_TASK_PRIORITY             (2U)
+
+/* Os Tasks stack size in 32-bit words in preemptive mode */
+#define OsConf_BUTTON_TASK_STACK_SIZE        (128U)
+#define OsConf_APP_TASK_STACK_SIZE           (128U)
+#define OsConf_LED_TASK_STACK_SIZE           (128U)
+
+/* Os Tasks declared worst case execution time in us, not used by the firmware but read by
+ * tools/os_analysis.py to check the task set (update them with the Max_Cycles of Os_GetTaskProfile) */
+#define OsConf_BUTTON_TASK_WCET              (100U)
+#define OsConf_APP_TASK_WCET                 (100U)
+#define OsConf_LED_TASK_WCET                 (100U)
+
+/* Number of the configured Os Counters */
+#define OS_CONFIGURED_COUNTERS               (1U)
+
+/* Counter Index in the array of structures in Os_PBcfg.c */
+#define OsConf_SYSTEM_COUNTER_ID_INDEX       (uint8)0x00
+
+/* System counter driven by the SysTick callback: maximum value before it wraps to 0,
+ * Os ticks (OS_BASE_TIME) per counter increment and shortest cycle accepted for an alarm */
+#define OsConf_SYSTEM_COUNTER_MAX_VALUE      (0xFFFFU)
+#define OsConf_SYSTEM_COUNTER_TICKS_PER_BASE (1U)
+#define OsConf_SYSTEM_COUNTER_MIN_CYCLE      (1U)
+
+/* Number of the configured Os Alarms (0 to 255) */
+#define OS_CONFIGURED_ALARMS                 (0U)
+
+/* Number of the configured Os Schedule Tables (255 Alarms and Schedule Tables at most) */
+#define OS_CONFIGURED_SCHEDULE_TABLES        (0U)
+
+/* Number of the configured Os Queues (0 to 255) */
+#define OS_CONFIGURED_QUEUES                 (1U)
+
+/* Queue Index in the array of structures in Os_PBcfg.c */
+#define OsConf_BUTTON_QUEUE_ID_INDEX         (uint8)0x00
+
+/* Number of elements the queue holds: button state changes sent by Button Task to App Task */
+#define OsConf_BUTTON_QUEUE_LENGTH           (4U)
+
+/* Number of the configured Os software Timers (0 to 65534) */
+#define OS_CONFIGURED_TIMERS                 (0U)
+
+/* Number of levels of the timer wheel (1 to 6), each level of 32 slots multiplies the longest
+ * timer by 32: 4 levels give 2^20 ticks (about 2.9 hours with a 10 Mili-seconds tick) */
+#define OS_TIMER_WHEEL_LEVELS                (4U)
+
+/* Number of the configured Os Resources (0 to 255) */
+#define OS_CONFIGURED_RESOURCES              (1U)
+
+/* Resource Index in the array of structures in Os_PBcfg.c */
+#define OsConf_LED_RESOURCE_ID_INDEX         (uint8)0x00
+
+/* Size in 32-bit words of the stack used by the interrupts (MSP) in preemptive mode,
+ * the stack reserved by the startup code is kept by Init Task and the idle loop */
+#define OS_ISR_STACK_SIZE                    (256U)
+
+/* Pre-compile option for the stack monitoring: the free part of every stack is painted by Os_start,
+ * the idle loop scans the high-water marks and the tick checks the guard words at the bottom of the
+ * stacks, a changed guard word calls Os_StackOverflowHook */
+#define OS_STACK_MONITORING                  (STD_ON)
+
+/* Lowest 32-bit words of every stack which must keep the paint pattern */
+#define OS_STACK_GUARD_WORDS                 (8U)
+
+/* 32-bit words checked by every pass of the idle loop in the high-water scan */
+#define OS_STACK_SCAN_WORDS                  (16U)
+
+/* Pre-compile option for the event trace: task start/end, context switch, tick, interrupt and user
+ * records stamped with the DWT cycle counter in the Os_Trace RAM ring buffer, a dump of Os_Trace is
+ * turned into a timeline by tools/os_trace.py */
+#define OS_TRACE                             (STD_ON)
+
+/* Number of 8-byte records kept in the trace ring buffer, a power of 2 */
+#define OS_TRACE_BUFFER_SIZE                 (64U)
+
+#endif /* OS_CFG_H_ */
@@ -0,0 +1,121 @@
+;******************************************************************************
+;
+; Module: Os
+;
+; File Name: Os_CortexM4.asm
+;
+; Description: Cortex-M4F context switching and interrupt masking routines used by the Os.
+;
+; Author: Yahia Hamimi
+;******************************************************************************
+
+        .thumb
+        .text
+        .align  2
+
+        .global PendSV_Handler
+        .global Os_CpuSwitchToProcessStack
+        .global Os_SwitchContext
+        .global Os_PortDisableInterrupts
+        .global Os_PortRestoreInterrupts
+        .global Os_PortGetIpsr
+        .global Os_PortRaiseBasePri
+        .global Os_PortSetBasePri
+
+;******************************************************************************
+; Service Name: Os_CpuSwitchToProcessStack
+; Parameters (in): R0 - Top of the stack reserved for the interrupts
+; Return value: None
+; Description: Move the thread mode to the process stack (PSP) keeping the
+;              stack in use by the caller, then give the main stack (MSP)
+;              to the interrupts so every task stack only holds its own frames.
+;******************************************************************************
+Os_CpuSwitchToProcessStack:
+        MRS     R1, MSP                 ; Current stack becomes the process stack
+        MSR     PSP, R1
+        MSR     MSP, R0                 ; Interrupts use their own stack from now on
+        MRS     R1, CONTROL
+        ORR     R1, R1, #2              ; SPSEL = 1 --> thread mode uses PSP
+        MSR     CONTROL, R1
+        ISB
+        BX      LR
+
+;******************************************************************************
+; Service Name: PendSV_Handler
+; Description: Lowest priority exception used to switch the tasks:
+;              - Save R4-R11, EXC_RETURN (and S16-S31 if the task used the FPU)
+;                on the stack of the running task
+;              - Ask Os_SwitchContext for the stack of the next task
+;              - Restore the context of the next task and return to it
+;******************************************************************************
+PendSV_Handler:
+        CPSID   I
+        MRS     R0, PSP
+        TST     LR, #0x10               ; EXC_RETURN bit 4 cleared --> FPU frame in use
+        IT      EQ
+        VSTMDBEQ R0!, {S16-S31}
+        STMDB   R0!, {R4-R11, LR}
+        BL      Os_SwitchContext        ; R0 = stack of the next task
+        LDMIA   R0!, {R4-R11, LR}
+        TST     LR, #0x10
+        IT      EQ
+        VLDMIAEQ R0!, {S16-S31}
+        MSR     PSP, R0
+        CPSIE   I
+        BX      LR
+
+;******************************************************************************
+; Service Name: Os_PortDisableInterrupts
+; Parameters (in): None
+; Return value: R0 - PRIMASK before masking the interrupts
+; Description: Enter a critical section which can be nested or used from an ISR.
+;******************************************************************************
+Os_PortDisableInterrupts:
+        MRS     R0, PRIMASK
+        CPSID   I
+        BX      LR
+
+;******************************************************************************
+; Service Name: Os_PortRestoreInterrupts
+; Parameters (in): R0 - PRIMASK returned by Os_PortDisableInterrupts
+; Return value: None
+; Description: Leave the critical section restoring the previous interrupt mask.
+;******************************************************************************
+Os_PortRestoreInterrupts:
+        MSR     PRIMASK, R0
+        BX      LR
+
+;******************************************************************************
+; Service Name: Os_PortGetIpsr
+; Parameters (in): None
+; Return value: R0 - Number of the exception in progress, 0 in thread mode
+; Description: Tell whether the caller is a task or an interrupt.
+;******************************************************************************
+Os_PortGetIpsr:
+        MRS     R0, IPSR
+        BX      LR
+
+;******************************************************************************
+; Service Name: Os_PortRaiseBasePri
+; Parameters (in): R0 - New BASEPRI (priority in bits 7:5, 0 leaves it unchanged)
+; Return value: R0 - BASEPRI before the call
+; Description: Mask the interrupts of priority R0 and lower, BASEPRI_MAX only
+;              takes the new value if it masks more than the current one.
+;******************************************************************************
+Os_PortRaiseBasePri:
+        MRS     R1, BASEPRI
+        MSR     BASEPRI_MAX, R0
+        MOV     R0, R1
+        BX      LR
+
+;******************************************************************************
+; Service Name: Os_PortSetBasePri
+; Parameters (in): R0 - BASEPRI returned by Os_PortRaiseBasePri
+; Return value: None
+; Description: Restore the interrupt priority mask.
+;******************************************************************************
+Os_PortSetBasePri:
+        MSR     BASEPRI, R0
+        BX      LR
+
+        .end
@@ -0,0 +1,63 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_PBcfg.c
+ *
+ * Description: Post Build Configuration Source file for Os Scheduler.
+ *
+ * Author: Yahia Hamimi
+ ******************************************************************************/
+
+#include "Os.h"
+#include "App.h"
+
+#if (OS_PREEMPTIVE_MODE == STD_ON)
+
+/* Private stack of each task in preemptive mode */
+STATIC uint32 Os_Button_Task_Stack[OsConf_BUTTON_TASK_STACK_SIZE];
+STATIC uint32 Os_App_Task_Stack[OsConf_APP_TASK_STACK_SIZE];
+STATIC uint32 Os_Led_Task_Stack[OsConf_LED_TASK_STACK_SIZE];
+
+#define OsConf_BUTTON_TASK_STACK             Os_Button_Task_Stack
+#define OsConf_APP_TASK_STACK                Os_App_Task_Stack
+#define OsConf_LED_TASK_STACK                Os_Led_Task_Stack
+
+#else
+
+/* No private stacks are needed by the cyclic executive */
+#define OsConf_BUTTON_TASK_STACK             NULL_PTR
+#define OsConf_APP_TASK_STACK                NULL_PTR
+#define OsConf_LED_TASK_STACK                NULL_PTR
+
+#endif
+
+/* Buffer of the queue carrying the button state changes */
+STATIC uint8 Os_Button_Queue_Buffer[OS_QUEUE_BUFFER_SIZE(OsConf_BUTTON_QUEUE_LENGTH, sizeof(uint8))];
+
+/* PB structure used to build the Os schedule table
+ * Tasks: Task entry function, Period, Offset, Priority, Stack, Stack size
+ * Counters: Max allowed value, Os ticks per base, Min cycle
+ * Queues: Buffer, Element size, Length, Notified task, Notification event
+ * Resources: Task ceiling priority, Interrupt ceiling priority */
+const Os_ConfigType Os_Configuration = {
+                                           {
+                                               { Button_Task, OsConf_BUTTON_TASK_PERIOD, OsConf_BUTTON_TASK_OFFSET, OsConf_BUTTON_TASK_PRIORITY,
+                                                 OsConf_BUTTON_TASK_STACK, OsConf_BUTTON_TASK_STACK_SIZE },
+                                               { App_Task,    OsConf_APP_TASK_PERIOD,    OsConf_APP_TASK_OFFSET,    OsConf_APP_TASK_PRIORITY,
+                                                 OsConf_APP_TASK_STACK,    OsConf_APP_TASK_STACK_SIZE    },
+                                               { Led_Task,    OsConf_LED_TASK_PERIOD,    OsConf_LED_TASK_OFFSET,    OsConf_LED_TASK_PRIORITY,
+                                                 OsConf_LED_TASK_STACK,    OsConf_LED_TASK_STACK_SIZE    }
+                                           },
+                                           {
+                                               { OsConf_SYSTEM_COUNTER_MAX_VALUE, OsConf_SYSTEM_COUNTER_TICKS_PER_BASE, OsConf_SYSTEM_COUNTER_MIN_CYCLE }
+                                           },
+                                           {
+                                               /* Button state changes from Button Task, every change activates App Task */
+                                               { Os_Button_Queue_Buffer, sizeof(uint8), OsConf_BUTTON_QUEUE_LENGTH, OsConf_APP_TASK_ID_INDEX, 0 }
+                                           },
+                                           {
+                                               /* Led state shared by App Task and Led Task, no interrupt uses it */
+                                               { OsConf_LED_TASK_PRIORITY, OS_RESOURCE_NO_ISR }
+                                           }
+                                       };
@@ -12,6 +12,7 @@
 
 #include "Port.h"
 #include "Port_Regs.h"
+#include "Mcu.h"
 
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
 
@@ -43,7 +44,7 @@ STATIC const Pin_ConfigType_Options *Pin_Ptr = NULL_PTR;
  * Parameters (out): None
  * Return value: None
  * Description: Function to Initialize the Port Driver module
- * by looping on each individual pin then:
+ * by enabling the clock of the ports of the configured pins only then looping on each individual pin:
  *              - Setup the pin initial value
  *              - Setup the direction of  pin
  *              - Setup the internal resistor for i/p pin
@@ -80,6 +81,15 @@ void Port_Init(const Port_ConfigType *ConfigPtr)
     volatile uint32 *PortGpio_Ptr = NULL_PTR; /* point to the required Port Registers base address */
 
     uint8 Pin_index;
+    uint8 Ports_Mask = 0;
+
+    /* Enable the clock of the ports used by the configuration and wait until all of them are ready,
+     * the ports without a configured pin stay unclocked */
+    for (Pin_index = 0; Pin_index < PORT_CONFIGURED_CHANNLES; Pin_index++)
+    {
+        Ports_Mask |= (uint8)(1U << Pin_Ptr[Pin_index].Port_num);
+    }
+    Mcu_EnableGpioClocks(Ports_Mask);
 
     /* looping for each pin structure of configuration in the port PB general configuration structure */
     for (Pin_index = 0; Pin_index < PORT_CONFIGURED_CHANNLES; Pin_index++)
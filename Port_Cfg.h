@@ -39,7 +39,7 @@
 #define PORT_SET_PIN_MODE_API               (STD_ON)
 
 /* Number of the configured Port Channels */
-#define PORT_CONFIGURED_CHANNLES             (43U)
+#define PORT_CONFIGURED_CHANNLES             (5U)
 
 
 /* Tiva-c Ports Symbolic names for PB configuration structure */
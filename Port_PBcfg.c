@@ -44,44 +44,6 @@
 
 
  const Port_ConfigType Port_Configuration = {
- TIVA_C_PORTA, TIVA_C_PORT_PIN0, PORT_PIN_IN, OFF, PORT_PIN_DIO_MODE, DIRECTION_NOT_CHANGEABLE, MODE_NOT_CHANGEABLE, STD_LOW,
- TIVA_C_PORTA, TIVA_C_PORT_PIN1, PORT_PIN_IN, OFF, PORT_PIN_DIO_MODE, DIRECTION_NOT_CHANGEABLE, MODE_NOT_CHANGEABLE, STD_LOW,
- TIVA_C_PORTA, TIVA_C_PORT_PIN2, PORT_PIN_IN, OFF, PORT_PIN_DIO_MODE, DIRECTION_NOT_CHANGEABLE, MODE_NOT_CHANGEABLE, STD_LOW,
- TIVA_C_PORTA, TIVA_C_PORT_PIN3, PORT_PIN_IN, OFF, PORT_PIN_DIO_MODE, DIRECTION_NOT_CHANGEABLE, MODE_NOT_CHANGEABLE, STD_LOW,
- TIVA_C_PORTA, TIVA_C_PORT_PIN4, PORT_PIN_IN, OFF, PORT_PIN_DIO_MODE, DIRECTION_NOT_CHANGEABLE, MODE_NOT_CHANGEABLE, STD_LOW,
- TIVA_C_PORTA, TIVA_C_PORT_PIN5, PORT_PIN_IN, OFF, PORT_PIN_DIO_MODE, DIRECTION_NOT_CHANGEABLE, MODE_NOT_CHANGEABLE, STD_LOW,
- TIVA_C_PORTA, TIVA_C_PORT_PIN6, PORT_PIN_IN, OFF, PORT_PIN_DIO_MODE, DIRECTION_NOT_CHANGEABLE, MODE_NOT_CHANGEABLE, STD_LOW,
- TIVA_C_PORTA, TIVA_C_PORT_PIN7, PORT_PIN_IN, OFF, PORT_PIN_DIO_MODE, DIRECTION_NOT_CHANGEABLE, MODE_NOT_CHANGEABLE, STD_LOW,
- TIVA_C_PORTB, TIVA_C_PORT_PIN0, PORT_PIN_IN, OFF, PORT_PIN_DIO_MODE, DIRECTION_NOT_CHANGEABLE, MODE_NOT_CHANGEABLE, STD_LOW,
- TIVA_C_PORTB, TIVA_C_PORT_PIN1, PORT_PIN_IN, OFF, PORT_PIN_DIO_MODE, DIRECTION_NOT_CHANGEABLE, MODE_NOT_CHANGEABLE, STD_LOW,
- TIVA_C_PORTB, TIVA_C_PORT_PIN2, PORT_PIN_IN, OFF, PORT_PIN_DIO_MODE, DIRECTION_NOT_CHANGEABLE, MODE_NOT_CHANGEABLE, STD_LOW,
- TIVA_C_PORTB, TIVA_C_PORT_PIN3, PORT_PIN_IN, OFF, PORT_PIN_DIO_MODE, DIRECTION_NOT_CHANGEABLE, MODE_NOT_CHANGEABLE, STD_LOW,
- TIVA_C_PORTB, TIVA_C_PORT_PIN4, PORT_PIN_IN, OFF, PORT_PIN_DIO_MODE, DIRECTION_NOT_CHANGEABLE, MODE_NOT_CHANGEABLE, STD_LOW,
- TIVA_C_PORTB, TIVA_C_PORT_PIN5, PORT_PIN_IN, OFF, PORT_PIN_DIO_MODE, DIRECTION_NOT_CHANGEABLE, MODE_NOT_CHANGEABLE, STD_LOW,
- TIVA_C_PORTB, TIVA_C_PORT_PIN6, PORT_PIN_IN, OFF, PORT_PIN_DIO_MODE, DIRECTION_NOT_CHANGEABLE, MODE_NOT_CHANGEABLE, STD_LOW,
- TIVA_C_PORTB, TIVA_C_PORT_PIN7, PORT_PIN_IN, OFF, PORT_PIN_DIO_MODE, DIRECTION_NOT_CHANGEABLE, MODE_NOT_CHANGEABLE, STD_LOW,
- TIVA_C_PORTC, TIVA_C_PORT_PIN0, PORT_PIN_IN, OFF, PORT_PIN_DIO_MODE, DIRECTION_NOT_CHANGEABLE, MODE_NOT_CHANGEABLE, STD_LOW,
- TIVA_C_PORTC, TIVA_C_PORT_PIN1, PORT_PIN_IN, OFF, PORT_PIN_DIO_MODE, DIRECTION_NOT_CHANGEABLE, MODE_NOT_CHANGEABLE, STD_LOW,
- TIVA_C_PORTC, TIVA_C_PORT_PIN2, PORT_PIN_IN, OFF, PORT_PIN_DIO_MODE, DIRECTION_NOT_CHANGEABLE, MODE_NOT_CHANGEABLE, STD_LOW,
- TIVA_C_PORTC, TIVA_C_PORT_PIN3, PORT_PIN_IN, OFF, PORT_PIN_DIO_MODE, DIRECTION_NOT_CHANGEABLE, MODE_NOT_CHANGEABLE, STD_LOW,
- TIVA_C_PORTC, TIVA_C_PORT_PIN4, PORT_PIN_IN, OFF, PORT_PIN_DIO_MODE, DIRECTION_NOT_CHANGEABLE, MODE_NOT_CHANGEABLE, STD_LOW,
- TIVA_C_PORTC, TIVA_C_PORT_PIN5, PORT_PIN_IN, OFF, PORT_PIN_DIO_MODE, DIRECTION_NOT_CHANGEABLE, MODE_NOT_CHANGEABLE, STD_LOW,
- TIVA_C_PORTC, TIVA_C_PORT_PIN6, PORT_PIN_IN, OFF, PORT_PIN_DIO_MODE, DIRECTION_NOT_CHANGEABLE, MODE_NOT_CHANGEABLE, STD_LOW,
- TIVA_C_PORTC, TIVA_C_PORT_PIN7, PORT_PIN_IN, OFF, PORT_PIN_DIO_MODE, DIRECTION_NOT_CHANGEABLE, MODE_NOT_CHANGEABLE, STD_LOW,
- TIVA_C_PORTD, TIVA_C_PORT_PIN0, PORT_PIN_IN, OFF, PORT_PIN_DIO_MODE, DIRECTION_NOT_CHANGEABLE, MODE_NOT_CHANGEABLE, STD_LOW,
- TIVA_C_PORTD, TIVA_C_PORT_PIN1, PORT_PIN_IN, OFF, PORT_PIN_DIO_MODE, DIRECTION_NOT_CHANGEABLE, MODE_NOT_CHANGEABLE, STD_LOW,
- TIVA_C_PORTD, TIVA_C_PORT_PIN2, PORT_PIN_IN, OFF, PORT_PIN_DIO_MODE, DIRECTION_NOT_CHANGEABLE, MODE_NOT_CHANGEABLE, STD_LOW,
- TIVA_C_PORTD, TIVA_C_PORT_PIN3, PORT_PIN_IN, OFF, PORT_PIN_DIO_MODE, DIRECTION_NOT_CHANGEABLE, MODE_NOT_CHANGEABLE, STD_LOW,
- TIVA_C_PORTD, TIVA_C_PORT_PIN4, PORT_PIN_IN, OFF, PORT_PIN_DIO_MODE, DIRECTION_NOT_CHANGEABLE, MODE_NOT_CHANGEABLE, STD_LOW,
- TIVA_C_PORTD, TIVA_C_PORT_PIN5, PORT_PIN_IN, OFF, PORT_PIN_DIO_MODE, DIRECTION_NOT_CHANGEABLE, MODE_NOT_CHANGEABLE, STD_LOW,
- TIVA_C_PORTD, TIVA_C_PORT_PIN6, PORT_PIN_IN, OFF, PORT_PIN_DIO_MODE, DIRECTION_NOT_CHANGEABLE, MODE_NOT_CHANGEABLE, STD_LOW,
- TIVA_C_PORTD, TIVA_C_PORT_PIN7, PORT_PIN_IN, OFF, PORT_PIN_DIO_MODE, DIRECTION_NOT_CHANGEABLE, MODE_NOT_CHANGEABLE, STD_LOW,
- TIVA_C_PORTE, TIVA_C_PORT_PIN0, PORT_PIN_IN, OFF, PORT_PIN_DIO_MODE, DIRECTION_NOT_CHANGEABLE, MODE_NOT_CHANGEABLE, STD_LOW,
- TIVA_C_PORTE, TIVA_C_PORT_PIN1, PORT_PIN_IN, OFF, PORT_PIN_DIO_MODE, DIRECTION_NOT_CHANGEABLE, MODE_NOT_CHANGEABLE, STD_LOW,
- TIVA_C_PORTE, TIVA_C_PORT_PIN2, PORT_PIN_IN, OFF, PORT_PIN_DIO_MODE, DIRECTION_NOT_CHANGEABLE, MODE_NOT_CHANGEABLE, STD_LOW,
- TIVA_C_PORTE, TIVA_C_PORT_PIN3, PORT_PIN_IN, OFF, PORT_PIN_DIO_MODE, DIRECTION_NOT_CHANGEABLE, MODE_NOT_CHANGEABLE, STD_LOW,
- TIVA_C_PORTE, TIVA_C_PORT_PIN4, PORT_PIN_IN, OFF, PORT_PIN_DIO_MODE, DIRECTION_NOT_CHANGEABLE, MODE_NOT_CHANGEABLE, STD_LOW,
- TIVA_C_PORTE, TIVA_C_PORT_PIN5, PORT_PIN_IN, OFF, PORT_PIN_DIO_MODE, DIRECTION_NOT_CHANGEABLE, MODE_NOT_CHANGEABLE, STD_LOW,
  TIVA_C_PORTF, TIVA_C_PORT_PIN0, PORT_PIN_IN, OFF, PORT_PIN_DIO_MODE, DIRECTION_NOT_CHANGEABLE, MODE_NOT_CHANGEABLE, STD_LOW,
  TIVA_C_PORTF, TIVA_C_PORT_PIN1, PORT_PIN_IN, OFF, PORT_PIN_DIO_MODE, DIRECTION_NOT_CHANGEABLE, MODE_NOT_CHANGEABLE, STD_LOW,
  TIVA_C_PORTF, TIVA_C_PORT_PIN2, PORT_PIN_IN, OFF, PORT_PIN_DIO_MODE, DIRECTION_NOT_CHANGEABLE, MODE_NOT_CHANGEABLE, STD_LOW,
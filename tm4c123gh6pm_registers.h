@@ -217,6 +217,13 @@ MPU Registers
 #define MPU_BASE3_REG             (*((volatile uint32 *)0xE000EDB4))
 #define MPU_ATTR3_REG             (*((volatile uint32 *)0xE000EDB8))
 
+/*****************************************************************************
+Data Watchpoint and Trace (DWT) Registers
+*****************************************************************************/
+#define CORE_DEMCR_REG            (*((volatile uint32 *)0xE000EDFC))
+#define DWT_CTRL_REG              (*((volatile uint32 *)0xE0001000))
+#define DWT_CYCCNT_REG            (*((volatile uint32 *)0xE0001004))
+
 /*****************************************************************************
 System Control Registers
 *****************************************************************************/
@@ -0,0 +1,339 @@
+#!/usr/bin/env python3
+################################################################################
+#
+# Module: Os
+#
+# File Name: os_analysis.py
+#
+# Description: Host-side schedulability and response time analysis of the Os
+#              task set. It reads the task configuration of Os_Cfg.h (period,
+#              offset, priority and declared WCET of every task, the shortest
+#              time between two activations of an event driven task) and checks:
+#              - The CPU utilization
+#              - The load of every OS_BASE_TIME tick and the response time of
+#                every task in the cyclic executive (late slots are executed
+#                one after another like OS_CATCHUP_EXECUTE_LATE)
+#              - The worst case response time of every task in the preemptive
+#                mode (fixed priority response time analysis, the offsets are
+#                ignored so the result is an upper bound)
+#
+#              The exit status is 1 when the configured mode is overloaded, so
+#              the tool can run as a pre-build step:
+#                  python3 tools/os_analysis.py
+#                  python3 tools/os_analysis.py --wcet BUTTON=350 --mode both
+#                  python3 tools/os_analysis.py --cycles --wcet APP=5200
+#
+# Author: Yahia Hamimi
+################################################################################
+
+import argparse
+import math
+import os
+import re
+import sys
+
+# Default location of the configuration, relative to this script
+REPO_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), os.pardir)
+
+# System clock used to convert the measured cycles (Os_GetTaskProfile) to us
+DEFAULT_CPU_HZ = 80000000
+
+DEFINE_PATTERN = re.compile(r"^\s*#define\s+(\w+)\s+(.+?)\s*(/\*.*)?$")
+TASK_ID_PATTERN = re.compile(r"^OsConf_(\w+)_TASK_ID_INDEX$")
+
+
+class ConfigError(Exception):
+    pass
+
+
+class Task(object):
+    def __init__(self, name, task_id, period, offset, priority, wcet, event_driven):
+        self.name = name
+        self.task_id = task_id
+        self.period = period        # us, shortest time between two activations of an event driven task
+        self.offset = offset        # us
+        self.priority = priority
+        self.wcet = wcet            # us
+        self.event_driven = event_driven
+
+
+def read_defines(paths):
+    """Collect the object-like macros of the given headers (the last definition wins)."""
+    defines = {}
+    for path in paths:
+        with open(path) as header:
+            for line in header:
+                match = DEFINE_PATTERN.match(line)
+                if match:
+                    defines[match.group(1)] = match.group(2)
+    return defines
+
+
+def evaluate(defines, name, depth=0):
+    """Evaluate a numeric macro the way the compiler sees it (casts, U/UL suffixes, other macros)."""
+    if name not in defines:
+        raise ConfigError("%s is not defined" % name)
+    if depth > 16:
+        raise ConfigError("%s cannot be evaluated" % name)
+
+    expression = defines[name]
+    expression = re.sub(r"\(\s*(uint8|uint16|uint32|uint64|Os_\w+Type)\s*\)", "", expression)
+    expression = re.sub(r"\b(0[xX][0-9a-fA-F]+|\d+)[uUlL]+\b", r"\1", expression)
+    expression = re.sub(r"\b([A-Za-z_]\w*)\b",
+                        lambda match: "(%d)" % evaluate(defines, match.group(1), depth + 1), expression)
+    try:
+        return int(eval(expression, {"__builtins__": {}}, {}))
+    except Exception:
+        raise ConfigError("%s = %s cannot be evaluated" % (name, defines[name]))
+
+
+def load_tasks(defines, wcet_overrides, wcet_scale):
+    tasks = []
+    for macro in defines:
+        match = TASK_ID_PATTERN.match(macro)
+        if not match:
+            continue
+        name = match.group(1)
+        prefix = "OsConf_%s_TASK_" % name
+        if name in wcet_overrides:
+            wcet = wcet_overrides.pop(name)
+        elif prefix + "WCET" in defines:
+            wcet = evaluate(defines, prefix + "WCET")
+        else:
+            raise ConfigError("no WCET for %s, declare %sWCET or use --wcet %s=<time>" % (name, prefix, name))
+        period = evaluate(defines, prefix + "PERIOD")
+        event_driven = period == 0
+        if event_driven:
+            if prefix + "MIN_INTERARRIVAL" not in defines:
+                raise ConfigError("%s is event driven, declare %sMIN_INTERARRIVAL" % (name, prefix))
+            period = evaluate(defines, prefix + "MIN_INTERARRIVAL")
+        tasks.append(Task(name,
+                          evaluate(defines, macro),
+                          period * 1000,
+                          evaluate(defines, prefix + "OFFSET") * 1000,
+                          evaluate(defines, prefix + "PRIORITY"),
+                          wcet * wcet_scale,
+                          event_driven))
+
+    if wcet_overrides:
+        raise ConfigError("unknown task(s) in --wcet: %s" % ", ".join(sorted(wcet_overrides)))
+    if len(tasks) != evaluate(defines, "OS_CONFIGURED_TASKS"):
+        raise ConfigError("OS_CONFIGURED_TASKS does not match the OsConf_xxx_TASK_ID_INDEX macros")
+
+    tasks.sort(key=lambda task: task.task_id)
+    return tasks
+
+
+def check_tasks(tasks, base_time):
+    """Same checks as Os_BuildScheduleTable."""
+    for task in tasks:
+        if task.event_driven:
+            if task.period == 0 or task.offset != 0:
+                raise ConfigError("%s: an event driven task needs a minimum interarrival time and no offset" % task.name)
+        elif task.period % base_time or task.offset % base_time or task.offset >= task.period:
+            raise ConfigError("%s: period and offset must be multiples of OS_BASE_TIME with offset < period" % task.name)
+
+
+def lcm(a, b):
+    return a // math.gcd(a, b) * b
+
+
+def event_ticks(task, base_time):
+    """An event driven task is activated at most once every ceil(interarrival / OS_BASE_TIME) ticks."""
+    return -(-task.period // base_time)
+
+
+def simulate_ticks(tasks, base_time, tick_overhead, phases, response, overruns):
+    """Simulate the cyclic executive tick by tick over a few hyperperiods.
+
+    Every tick the interrupt takes tick_overhead, then the scheduler runs the tasks due in the
+    slot in Task Id order followed by the activated event driven tasks (released at the tick given
+    by phases). A slot still running at the next tick delays the next slot (late execution).
+    """
+    hyper_period = 1
+    for task in tasks:
+        period_ticks = event_ticks(task, base_time) if task.event_driven else task.period // base_time
+        hyper_period = lcm(hyper_period, period_ticks)
+
+    slots = []
+    for slot in range(hyper_period):
+        slots.append([task for task in tasks
+                      if not task.event_driven and slot % (task.period // base_time) == task.offset // base_time]
+                     + [task for task in tasks
+                        if task.event_driven and slot % event_ticks(task, base_time) == phases[task.name]])
+
+    backlog = []    # [task, release time, remaining time]
+    capacity = base_time - tick_overhead
+
+    # Three hyperperiods: the first one may start without backlog, the worst case shows up later
+    for tick in range(3 * hyper_period):
+        tick_time = tick * base_time
+        for task in slots[tick % hyper_period]:
+            backlog.append([task, tick_time, task.wcet])
+
+        used = 0
+        while backlog and used < capacity:
+            job = backlog[0]
+            run = min(job[2], capacity - used)
+            job[2] -= run
+            used += run
+            if job[2] == 0:
+                finish = tick_time + tick_overhead + used
+                task = job[0]
+                response[task.name] = max(response[task.name], finish - job[1])
+                # The Os counts a deadline overrun when a tick arrives while the task runs
+                if finish > job[1] + base_time:
+                    overruns[task.name] += 1
+                backlog.pop(0)
+
+
+def cyclic_executive(tasks, base_time, tick_overhead):
+    """Load of every tick of the periodic tasks and worst response time and overruns of every task.
+
+    Each event driven task is tried at every possible activation tick, the others at the first one.
+    """
+    response = dict((task.name, 0) for task in tasks)
+    overruns = dict((task.name, 0) for task in tasks)
+    event_tasks = [task for task in tasks if task.event_driven]
+    phases = dict((task.name, 0) for task in event_tasks)
+
+    simulate_ticks(tasks, base_time, tick_overhead, phases, response, overruns)
+    for task in event_tasks:
+        for phase in range(1, event_ticks(task, base_time)):
+            trial_overruns = dict((other.name, 0) for other in tasks)
+            simulate_ticks(tasks, base_time, tick_overhead, dict(phases, **{task.name: phase}), response, trial_overruns)
+            for name in overruns:
+                overruns[name] = max(overruns[name], trial_overruns[name])
+
+    periodic_tasks = [task for task in tasks if not task.event_driven]
+    hyper_period = 1
+    for task in periodic_tasks:
+        hyper_period = lcm(hyper_period, task.period // base_time)
+
+    loads = []
+    for slot in range(hyper_period):
+        due = [task for task in periodic_tasks if slot % (task.period // base_time) == task.offset // base_time]
+        loads.append((slot, [task.name for task in due], tick_overhead + sum(task.wcet for task in due)))
+    return loads, response, overruns
+
+
+def response_time_analysis(tasks, base_time, tick_overhead, switch_overhead):
+    """Fixed priority response time analysis: R = C + sum(ceil(R / Tj) * Cj) over the higher priority tasks.
+
+    The tick interrupt is the highest priority periodic load. A preemption costs two context switches.
+    Returns None for a task whose response time exceeds its period (the next activation would be lost).
+    """
+    results = {}
+    for task in tasks:
+        higher = [other for other in tasks if other.priority > task.priority]
+        cost = task.wcet + switch_overhead
+        response = cost
+        while True:
+            interference = math.ceil(response / base_time) * tick_overhead
+            for other in higher:
+                interference += math.ceil(response / other.period) * (other.wcet + 2 * switch_overhead)
+            new_response = cost + interference
+            if new_response > task.period:
+                results[task.name] = None
+                break
+            if new_response == response:
+                results[task.name] = response
+                break
+            response = new_response
+    return results
+
+
+def parse_arguments():
+    parser = argparse.ArgumentParser(description="Schedulability analysis of the Os task set in Os_Cfg.h")
+    parser.add_argument("--config", action="append",
+                        help="header with the Os configuration (default: Std_Types.h and Os_Cfg.h of the project)")
+    parser.add_argument("--wcet", action="append", default=[], metavar="TASK=TIME",
+                        help="override the declared WCET of a task (TASK as in OsConf_<TASK>_TASK_ID_INDEX)")
+    parser.add_argument("--cycles", action="store_true",
+                        help="the WCETs are CPU cycles (Max_Cycles of Os_GetTaskProfile) instead of us")
+    parser.add_argument("--cpu-hz", type=int, default=DEFAULT_CPU_HZ, help="CPU clock used with --cycles")
+    parser.add_argument("--tick-overhead", type=float, default=0.0, help="tick interrupt execution time in us")
+    parser.add_argument("--switch-overhead", type=float, default=0.0, help="preemptive context switch time in us")
+    parser.add_argument("--mode", choices=("configured", "cyclic", "preemptive", "both"), default="configured",
+                        help="mode(s) deciding the exit status (default: OS_PREEMPTIVE_MODE of Os_Cfg.h)")
+    return parser.parse_args()
+
+
+def main():
+    arguments = parse_arguments()
+    configs = arguments.config or [os.path.join(REPO_DIR, "Std_Types.h"), os.path.join(REPO_DIR, "Os_Cfg.h")]
+
+    try:
+        wcet_overrides = {}
+        for item in arguments.wcet:
+            name, _, value = item.partition("=")
+            if not value:
+                raise ConfigError("--wcet expects TASK=TIME, got %s" % item)
+            wcet_overrides[name.upper()] = float(value)
+
+        wcet_scale = 1000000.0 / arguments.cpu_hz if arguments.cycles else 1.0
+        defines = read_defines(configs)
+        base_time = evaluate(defines, "OS_BASE_TIME") * 1000
+        preemptive = evaluate(defines, "OS_PREEMPTIVE_MODE") != 0
+        tasks = load_tasks(defines, wcet_overrides, wcet_scale)
+        check_tasks(tasks, base_time)
+        if len(set(task.priority for task in tasks)) != len(tasks):
+            raise ConfigError("the task priorities must be unique")
+    except (ConfigError, IOError, ValueError) as error:
+        sys.stderr.write("os_analysis: %s\n" % error)
+        return 2
+
+    utilization = sum(task.wcet / task.period for task in tasks) + arguments.tick_overhead / base_time
+    print("OS_BASE_TIME %d ms, %d tasks, configured mode: %s"
+          % (base_time // 1000, len(tasks), "preemptive" if preemptive else "cyclic executive"))
+    print("CPU utilization: %.2f %%" % (100.0 * utilization))
+    print("")
+    print("%-12s %10s %8s %8s %10s" % ("Task", "Period", "Offset", "Priority", "WCET [us]"))
+    for task in tasks:
+        print("%-12s %10s %8d %8d %10.1f" % (task.name, ("event>=%d" if task.event_driven else "%d") % (task.period // 1000),
+                                           task.offset // 1000, task.priority, task.wcet))
+
+    # Cyclic executive
+    loads, cyclic_response, overruns = cyclic_executive(tasks, base_time, arguments.tick_overhead)
+    peak = max(load for _, _, load in loads)
+    print("")
+    print("Cyclic executive: load of every tick of the hyperperiod (%d ticks)" % len(loads))
+    for slot, names, load in loads:
+        print("  tick %3d  %6.1f us  %5.1f %%  %s" % (slot, load, 100.0 * load / base_time, " ".join(names)))
+    print("  peak load %.1f us (%.1f %% of OS_BASE_TIME)" % (peak, 100.0 * peak / base_time))
+    event_load = sum(task.wcet for task in tasks if task.event_driven)
+    if event_load:
+        print("  peak load with all the event driven tasks %.1f us (%.1f %% of OS_BASE_TIME)"
+              % (peak + event_load, 100.0 * (peak + event_load) / base_time))
+    print("%-12s %14s %16s" % ("Task", "Response [us]", "Deadline overruns"))
+    for task in tasks:
+        print("%-12s %14.1f %16d" % (task.name, cyclic_response[task.name], overruns[task.name]))
+    cyclic_ok = utilization <= 1.0 and not any(overruns.values())
+
+    # Preemptive mode
+    preemptive_response = response_time_analysis(tasks, base_time, arguments.tick_overhead, arguments.switch_overhead)
+    print("")
+    print("Preemptive mode: worst case response time (offsets ignored, upper bound)")
+    print("%-12s %14s %10s" % ("Task", "Response [us]", "Period"))
+    for task in sorted(tasks, key=lambda task: -task.priority):
+        response = preemptive_response[task.name]
+        print("%-12s %14s %10d" % (task.name, "> period" if response is None else "%.1f" % response, task.period // 1000))
+    preemptive_ok = utilization <= 1.0 and None not in preemptive_response.values()
+
+    print("")
+    print("Cyclic executive: %s" % ("OK" if cyclic_ok else "OVERLOADED"))
+    print("Preemptive mode:  %s" % ("OK" if preemptive_ok else "OVERLOADED"))
+
+    if arguments.mode == "configured":
+        verdict = preemptive_ok if preemptive else cyclic_ok
+    elif arguments.mode == "cyclic":
+        verdict = cyclic_ok
+    elif arguments.mode == "preemptive":
+        verdict = preemptive_ok
+    else:
+        verdict = cyclic_ok and preemptive_ok
+    return 0 if verdict else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
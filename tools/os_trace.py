@@ -0,0 +1,204 @@
+#!/usr/bin/env python3
+################################################################################
+#
+# Module: Os
+#
+# File Name: os_trace.py
+#
+# Description: Host-side decoder of the Os event trace (OS_TRACE). It reads a
+#              memory dump of the Os_Trace variable and prints the records
+#              from the oldest to the newest as a timeline, followed by the
+#              number of runs and the longest start to end time of every task.
+#
+#              The dump is the Os_Trace variable saved from the debugger
+#              (sizeof(Os_TraceBufferType) bytes from &Os_Trace), either as a
+#              raw binary file or as a TI Data file of 32-bit words:
+#                  python3 tools/os_trace.py trace.bin
+#                  python3 tools/os_trace.py --cpu-hz 16000000 trace.dat
+#
+#              The timestamps are DWT cycles, the cycle counter stops while the
+#              CPU sleeps in the tickless idle so the time is realigned on the
+#              Os time carried by every tick record.
+#
+# Author: Yahia Hamimi
+################################################################################
+
+import argparse
+import os
+import struct
+import sys
+
+from os_analysis import REPO_DIR, DEFAULT_CPU_HZ, TASK_ID_PATTERN, ConfigError, read_defines, evaluate
+
+# Layout of Os_TraceBufferType: uint32 Count, then Os_TraceRecordType records (little endian)
+COUNT_FORMAT = "<I"
+RECORD_FORMAT = "<IBBH"
+RECORD_SIZE = struct.calcsize(RECORD_FORMAT)
+
+# OS_TRACE_TYPE_xxx of Os.h
+TRACE_TASK_START = 0x01
+TRACE_TASK_END = 0x02
+TRACE_TASK_SWITCH = 0x03
+TRACE_TICK = 0x04
+TRACE_ISR_ENTER = 0x05
+TRACE_ISR_EXIT = 0x06
+TRACE_OVERRUN = 0x07
+TRACE_MARKER = 0x08
+
+# OS_TRACE_ISR_SYSTICK of Os.h
+ISR_SYSTICK = 0x00
+
+# OS_OVERRUN_xxx of Os.h
+OVERRUN_REASONS = {0: "deadline", 1: "activation lost"}
+
+
+class TraceError(Exception):
+    pass
+
+
+def read_dump(path):
+    """Words of a TI Data file (header line starting with 1651) or bytes of a raw binary dump."""
+    with open(path, "rb") as dump:
+        content = dump.read()
+    if not content.startswith(b"1651"):
+        return content
+    words = []
+    for line in content.decode("ascii", "replace").splitlines()[1:]:
+        line = line.strip()
+        if line:
+            words.append(int(line, 16))
+    return struct.pack("<%dI" % len(words), *words)
+
+
+def decode(content):
+    """Records of the ring buffer from the oldest to the newest and the number of overwritten ones."""
+    if len(content) < struct.calcsize(COUNT_FORMAT) + RECORD_SIZE:
+        raise TraceError("the dump is too short for Os_Trace")
+    size = (len(content) - struct.calcsize(COUNT_FORMAT)) // RECORD_SIZE
+    if size & (size - 1):
+        raise TraceError("%d records in the dump, OS_TRACE_BUFFER_SIZE is a power of 2" % size)
+
+    count = struct.unpack_from(COUNT_FORMAT, content)[0]
+    records = [struct.unpack_from(RECORD_FORMAT, content, struct.calcsize(COUNT_FORMAT) + index * RECORD_SIZE)
+               for index in range(size)]
+    if count <= size:
+        return records[:count], 0
+    first = count % size
+    return records[first:] + records[:first], count - size
+
+
+def timeline(records, cpu_hz, base_time_us):
+    """Time in us of every record.
+
+    The cycle counter gives the time between two records. It stops while the CPU sleeps, so every
+    tick record moves the time to its Os time (the low 16 bits of the tick count are unwrapped).
+    """
+    times = []
+    time = 0.0
+    previous_cycles = None
+    previous_tick = None
+    tick_time = None
+    for timestamp, record_type, _, data in records:
+        if previous_cycles is not None:
+            time += ((timestamp - previous_cycles) & 0xFFFFFFFF) * 1000000.0 / cpu_hz
+        previous_cycles = timestamp
+        if record_type == TRACE_TICK:
+            if previous_tick is None:
+                tick_time = time
+            else:
+                tick_time += ((data - previous_tick) & 0xFFFF) * base_time_us
+                time = max(time, tick_time)
+            previous_tick = data
+        times.append(time)
+    return times
+
+
+def describe(record, task_names, idle_id):
+    _, record_type, record_id, data = record
+    task = task_names.get(record_id, "task %d" % record_id)
+    if record_type == TRACE_TASK_START:
+        return "start    %s" % task
+    if record_type == TRACE_TASK_END:
+        return "end      %s" % task
+    if record_type == TRACE_TASK_SWITCH:
+        return "switch   %s" % ("idle" if record_id == idle_id else task)
+    if record_type == TRACE_TICK:
+        return "tick     Os time %d (%d tick%s)" % (data, record_id, "s" if record_id != 1 else "")
+    if record_type == TRACE_ISR_ENTER:
+        return "isr in   %d" % record_id
+    if record_type == TRACE_ISR_EXIT:
+        return "isr out  %s" % ("SysTick" if record_id == ISR_SYSTICK else record_id)
+    if record_type == TRACE_OVERRUN:
+        return "OVERRUN  %s %s" % (task, OVERRUN_REASONS.get(data, data))
+    if record_type == TRACE_MARKER:
+        return "marker   %d data 0x%04X" % (record_id, data)
+    return "unknown  type 0x%02X id %d data 0x%04X" % (record_type, record_id, data)
+
+
+def task_statistics(records, times):
+    """Number of complete runs and longest start to end time (preemptions included) of every task."""
+    started = {}
+    statistics = {}
+    for record, time in zip(records, times):
+        _, record_type, record_id, _ = record
+        if record_type == TRACE_TASK_START:
+            started[record_id] = time
+        elif record_type == TRACE_TASK_END and record_id in started:
+            duration = time - started.pop(record_id)
+            runs, longest = statistics.get(record_id, (0, 0.0))
+            statistics[record_id] = (runs + 1, max(longest, duration))
+    return statistics
+
+
+def parse_arguments():
+    parser = argparse.ArgumentParser(description="Decode a dump of the Os_Trace ring buffer into a timeline")
+    parser.add_argument("dump", help="raw binary or TI Data dump of the Os_Trace variable")
+    parser.add_argument("--config", action="append",
+                        help="header with the Os configuration (default: Std_Types.h and Os_Cfg.h of the project)")
+    parser.add_argument("--cpu-hz", type=int, default=DEFAULT_CPU_HZ, help="CPU clock of the cycle counter")
+    return parser.parse_args()
+
+
+def main():
+    arguments = parse_arguments()
+    configs = arguments.config or [os.path.join(REPO_DIR, "Std_Types.h"), os.path.join(REPO_DIR, "Os_Cfg.h")]
+
+    try:
+        defines = read_defines(configs)
+        base_time_us = evaluate(defines, "OS_BASE_TIME") * 1000
+        idle_id = evaluate(defines, "OS_CONFIGURED_TASKS")
+        task_names = {}
+        for macro in defines:
+            match = TASK_ID_PATTERN.match(macro)
+            if match:
+                task_names[evaluate(defines, macro)] = match.group(1)
+        records, lost = decode(read_dump(arguments.dump))
+    except (ConfigError, TraceError, IOError, ValueError) as error:
+        sys.stderr.write("os_trace: %s\n" % error)
+        return 2
+
+    if not records:
+        print("The trace is empty")
+        return 0
+
+    times = timeline(records, arguments.cpu_hz, base_time_us)
+    print("%d records%s" % (len(records), ", %d older records overwritten" % lost if lost else ""))
+    print("")
+    print("%12s %10s  %s" % ("Time [us]", "Delta", "Event"))
+    previous = times[0]
+    for record, time in zip(records, times):
+        print("%12.1f %10.1f  %s" % (time - times[0], time - previous, describe(record, task_names, idle_id)))
+        previous = time
+
+    statistics = task_statistics(records, times)
+    if statistics:
+        print("")
+        print("%-12s %6s %18s" % ("Task", "Runs", "Longest run [us]"))
+        for task_id in sorted(statistics):
+            runs, longest = statistics[task_id]
+            print("%-12s %6d %18.1f" % (task_names.get(task_id, "task %d" % task_id), runs, longest))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())